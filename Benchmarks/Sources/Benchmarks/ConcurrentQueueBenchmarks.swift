@@ -0,0 +1,341 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import Foundation
+import CollectionsBenchmark
+import DequeModule
+
+/// A `Deque` protected by a lock, used as the baseline for the concurrent
+/// queue benchmarks.
+internal final class _LockedDeque<Element>: @unchecked Sendable {
+  internal let _lock = NSLock()
+  internal var _deque: Deque<Element> = []
+
+  internal init() {}
+
+  internal func append(_ element: Element) {
+    _lock.lock()
+    _deque.append(element)
+    _lock.unlock()
+  }
+
+  internal func append(contentsOf elements: some Sequence<Element>) {
+    _lock.lock()
+    _deque.append(contentsOf: elements)
+    _lock.unlock()
+  }
+
+  internal func popFirst() -> Element? {
+    _lock.lock()
+    defer { _lock.unlock() }
+    return _deque.popFirst()
+  }
+
+  internal func popFirst(
+    maximumCount: Int,
+    into target: inout [Element]
+  ) -> Int {
+    _lock.lock()
+    defer { _lock.unlock() }
+    let n = Swift.min(maximumCount, _deque.count)
+    target.append(contentsOf: _deque.prefix(n))
+    _deque.removeFirst(n)
+    return n
+  }
+}
+
+/// Run each of the given closures on its own thread, and wait until all of
+/// them finish.
+internal func _runOnSeparateThreads(_ bodies: [@Sendable () -> Void]) {
+  let done = DispatchSemaphore(value: 0)
+  for body in bodies {
+    let thread = Thread {
+      body()
+      done.signal()
+    }
+    thread.start()
+  }
+  for _ in bodies {
+    done.wait()
+  }
+}
+
+extension Benchmark {
+  public mutating func addConcurrentQueueBenchmarks() {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      return
+    }
+
+    self.add(
+      title: "SPSCQueue<Int> push/pop (single thread)",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        let queue = SPSCQueue<Int>(minimumCapacity: 256)
+        timer.measure {
+          for i in input {
+            _ = queue.tryPush(i)
+            blackHole(queue.tryPop())
+          }
+        }
+      }
+    }
+
+    self.add(
+      title: "SPSCQueue<Int> producer/consumer transfer",
+      input: Int.self
+    ) { size in
+      return { timer in
+        let queue = SPSCQueue<Int>(minimumCapacity: 1024)
+        timer.measure {
+          _runOnSeparateThreads([
+            {
+              for i in 0 ..< size {
+                queue.push(i)
+              }
+            },
+            {
+              for _ in 0 ..< size {
+                blackHole(queue.pop())
+              }
+            },
+          ])
+        }
+      }
+    }
+
+    self.add(
+      title: "SPSCQueue<Int> producer/consumer transfer, batches of 64",
+      input: Int.self
+    ) { size in
+      return { timer in
+        let queue = SPSCQueue<Int>(minimumCapacity: 1024)
+        timer.measure {
+          _runOnSeparateThreads([
+            {
+              var i = 0
+              while i < size {
+                let batch = i ..< Swift.min(i + 64, size)
+                let pushed = queue.tryPush(contentsOf: batch)
+                if pushed == 0 { _yieldForBenchmark() }
+                i += pushed
+              }
+            },
+            {
+              var received: [Int] = []
+              received.reserveCapacity(64)
+              var remaining = size
+              while remaining > 0 {
+                received.removeAll(keepingCapacity: true)
+                let popped = queue.tryPop(maximumCount: 64, into: &received)
+                if popped == 0 { _yieldForBenchmark() }
+                blackHole(received)
+                remaining -= popped
+              }
+            },
+          ])
+        }
+      }
+    }
+
+    self.add(
+      title: "Deque<Int> with lock producer/consumer transfer",
+      input: Int.self
+    ) { size in
+      return { timer in
+        let queue = _LockedDeque<Int>()
+        timer.measure {
+          _runOnSeparateThreads([
+            {
+              for i in 0 ..< size {
+                queue.append(i)
+              }
+            },
+            {
+              var remaining = size
+              while remaining > 0 {
+                if let value = queue.popFirst() {
+                  blackHole(value)
+                  remaining -= 1
+                } else {
+                  _yieldForBenchmark()
+                }
+              }
+            },
+          ])
+        }
+      }
+    }
+
+    self.add(
+      title: "SPSCQueue<Int> ping-pong round trips",
+      input: Int.self
+    ) { size in
+      return { timer in
+        let requests = SPSCQueue<Int>(minimumCapacity: 1)
+        let responses = SPSCQueue<Int>(minimumCapacity: 1)
+        timer.measure {
+          _runOnSeparateThreads([
+            {
+              for i in 0 ..< size {
+                requests.push(i)
+                blackHole(responses.pop())
+              }
+            },
+            {
+              for _ in 0 ..< size {
+                responses.push(requests.pop())
+              }
+            },
+          ])
+        }
+      }
+    }
+
+    self.add(
+      title: "Deque<Int> with lock ping-pong round trips",
+      input: Int.self
+    ) { size in
+      return { timer in
+        let requests = _LockedDeque<Int>()
+        let responses = _LockedDeque<Int>()
+        timer.measure {
+          _runOnSeparateThreads([
+            {
+              for i in 0 ..< size {
+                requests.append(i)
+                while true {
+                  if let value = responses.popFirst() {
+                    blackHole(value)
+                    break
+                  }
+                }
+              }
+            },
+            {
+              for _ in 0 ..< size {
+                while true {
+                  if let value = requests.popFirst() {
+                    responses.append(value)
+                    break
+                  }
+                }
+              }
+            },
+          ])
+        }
+      }
+    }
+
+    for threads in [1, 2, 4, 8, 16, 32, 64] {
+      // Every thread alternates between pushing and popping, so that the
+      // queue is shared between `threads` producers and `threads` consumers.
+      self.add(
+        title: "MPMCQueue<Int> push/pop (\(threads) threads)",
+        input: Int.self
+      ) { size in
+        return { timer in
+          let queue = MPMCQueue<Int>(minimumCapacity: 1024)
+          let rounds = Swift.max(1, size / threads)
+          timer.measure {
+            _runOnSeparateThreads(Array(repeating: {
+              for i in 0 ..< rounds {
+                queue.push(i)
+                blackHole(queue.pop())
+              }
+            }, count: threads))
+          }
+        }
+      }
+
+      self.add(
+        title: "MPMCQueue<Int> bulk push/pop, batches of 16 (\(threads) threads)",
+        input: Int.self
+      ) { size in
+        return { timer in
+          let queue = MPMCQueue<Int>(minimumCapacity: 1024)
+          let rounds = Swift.max(1, size / (16 * threads))
+          timer.measure {
+            _runOnSeparateThreads(Array(repeating: {
+              var received: [Int] = []
+              received.reserveCapacity(16)
+              for i in 0 ..< rounds {
+                var pushed = 0
+                while pushed < 16 {
+                  pushed += queue.tryPush(contentsOf: i &+ pushed ..< i &+ 16)
+                }
+                received.removeAll(keepingCapacity: true)
+                while received.count < 16 {
+                  _ = queue.tryPop(maximumCount: 16 - received.count, into: &received)
+                }
+                blackHole(received)
+              }
+            }, count: threads))
+          }
+        }
+      }
+
+      self.add(
+        title: "Deque<Int> with lock push/pop (\(threads) threads)",
+        input: Int.self
+      ) { size in
+        return { timer in
+          let queue = _LockedDeque<Int>()
+          let rounds = Swift.max(1, size / threads)
+          timer.measure {
+            _runOnSeparateThreads(Array(repeating: {
+              for i in 0 ..< rounds {
+                queue.append(i)
+                while true {
+                  if let value = queue.popFirst() {
+                    blackHole(value)
+                    break
+                  }
+                }
+              }
+            }, count: threads))
+          }
+        }
+      }
+
+      self.add(
+        title: "Deque<Int> with lock bulk push/pop, batches of 16 (\(threads) threads)",
+        input: Int.self
+      ) { size in
+        return { timer in
+          let queue = _LockedDeque<Int>()
+          let rounds = Swift.max(1, size / (16 * threads))
+          timer.measure {
+            _runOnSeparateThreads(Array(repeating: {
+              var received: [Int] = []
+              received.reserveCapacity(16)
+              for i in 0 ..< rounds {
+                queue.append(contentsOf: i ..< i + 16)
+                received.removeAll(keepingCapacity: true)
+                while received.count < 16 {
+                  _ = queue.popFirst(
+                    maximumCount: 16 - received.count, into: &received)
+                }
+                blackHole(received)
+              }
+            }, count: threads))
+          }
+        }
+      }
+    }
+  }
+}
+
+internal func _yieldForBenchmark() {
+  Thread.sleep(forTimeInterval: 0)
+}
+#endif
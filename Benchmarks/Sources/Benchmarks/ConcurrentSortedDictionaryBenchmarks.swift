@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import Foundation
+import CollectionsBenchmark
+import SortedCollections
+
+/// A `SortedDictionary` protected by a lock, used as the baseline for the
+/// concurrent sorted dictionary benchmarks.
+internal final class _LockedSortedDictionary<Key: Comparable, Value>: @unchecked Sendable {
+  internal let _lock = NSLock()
+  internal var _dictionary: SortedDictionary<Key, Value> = [:]
+
+  internal init(_ dictionary: SortedDictionary<Key, Value>) {
+    _dictionary = dictionary
+  }
+
+  internal subscript(key: Key) -> Value? {
+    get {
+      _lock.lock()
+      defer { _lock.unlock() }
+      return _dictionary[key]
+    }
+    set {
+      _lock.lock()
+      _dictionary[key] = newValue
+      _lock.unlock()
+    }
+  }
+}
+
+extension Benchmark {
+  public mutating func addConcurrentSortedDictionaryBenchmarks() {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      return
+    }
+
+    // One writer updates every key once while each reader looks up every
+    // key once.
+    for readerCount in [1, 2, 4, 8] {
+      self.add(
+        title: "ConcurrentSortedDictionary<Int, Int> 1 writer, \(readerCount) readers",
+        input: ([Int], [Int]).self
+      ) { input, lookups in
+        let initial = SortedDictionary(
+          sortedKeysWithValues: input.sorted().lazy.map { (key: $0, value: $0) })
+        return { timer in
+          let d = ConcurrentSortedDictionary(initial)
+          let writer: @Sendable () -> Void = {
+            for key in input {
+              d.update { $0[key] = -key }
+            }
+          }
+          let reader: @Sendable () -> Void = {
+            for key in lookups {
+              blackHole(d[key])
+            }
+          }
+          timer.measure {
+            _runOnSeparateThreads(
+              [writer] + Array(repeating: reader, count: readerCount))
+          }
+        }
+      }
+
+      self.add(
+        title: "ConcurrentSortedDictionary<Int, Int> 1 writer, \(readerCount) snapshot readers",
+        input: ([Int], [Int]).self
+      ) { input, lookups in
+        let initial = SortedDictionary(
+          sortedKeysWithValues: input.sorted().lazy.map { (key: $0, value: $0) })
+        return { timer in
+          let d = ConcurrentSortedDictionary(initial)
+          let writer: @Sendable () -> Void = {
+            for key in input {
+              d.update { $0[key] = -key }
+            }
+          }
+          let reader: @Sendable () -> Void = {
+            // Take a fresh snapshot for every batch of 64 lookups.
+            var snapshot = d.snapshot()
+            for (i, key) in lookups.enumerated() {
+              if i % 64 == 0 { snapshot = d.snapshot() }
+              blackHole(snapshot[key])
+            }
+          }
+          timer.measure {
+            _runOnSeparateThreads(
+              [writer] + Array(repeating: reader, count: readerCount))
+          }
+        }
+      }
+
+      self.add(
+        title: "SortedDictionary<Int, Int> with lock, 1 writer, \(readerCount) readers",
+        input: ([Int], [Int]).self
+      ) { input, lookups in
+        let initial = SortedDictionary(
+          sortedKeysWithValues: input.sorted().lazy.map { (key: $0, value: $0) })
+        return { timer in
+          let d = _LockedSortedDictionary(initial)
+          let writer: @Sendable () -> Void = {
+            for key in input {
+              d[key] = -key
+            }
+          }
+          let reader: @Sendable () -> Void = {
+            for key in lookups {
+              blackHole(d[key])
+            }
+          }
+          timer.measure {
+            _runOnSeparateThreads(
+              [writer] + Array(repeating: reader, count: readerCount))
+          }
+        }
+      }
+    }
+  }
+}
+#endif
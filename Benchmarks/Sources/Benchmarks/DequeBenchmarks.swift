@@ -315,6 +315,38 @@ extension Benchmark {
       }
     }
 
+    self.add(
+      title: "Deque<Int> partition around nth element (contiguous)",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        guard !input.isEmpty else { return }
+        let n = input.count / 2
+        var deque = Deque(input)
+        timer.measure {
+          let median = deque.partition(aroundNthElement: n)
+          precondition(median == n)
+        }
+        blackHole(deque)
+      }
+    }
+
+    self.add(
+      title: "Deque<Int> partition around nth element (discontiguous)",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        guard !input.isEmpty else { return }
+        let n = input.count / 2
+        var deque = Deque(discontiguous: input)
+        timer.measure {
+          let median = deque.partition(aroundNthElement: n)
+          precondition(median == n)
+        }
+        blackHole(deque)
+      }
+    }
+
     self.addSimple(
       title: "Deque<Int> append from range",
       input: Int.self
@@ -374,6 +406,71 @@ extension Benchmark {
       blackHole(deque)
     }
 
+    self.add(
+      title: "Deque<Int> append contents of Deque (discontiguous)",
+      input: [Int].self
+    ) { input in
+      let source = Deque(discontiguous: input)
+      return { timer in
+        var deque: Deque<Int> = []
+        timer.measure {
+          deque.append(contentsOf: source)
+        }
+        precondition(deque.count == input.count)
+        blackHole(deque)
+      }
+    }
+
+    self.add(
+      title: "Deque<Int> append contents of Deque as generic collection (discontiguous)",
+      input: [Int].self
+    ) { input in
+      func appendCollection<C: Collection>(
+        _ elements: C, to deque: inout Deque<C.Element>
+      ) {
+        deque.append(contentsOf: elements)
+      }
+      let source = Deque(discontiguous: input)
+      return { timer in
+        var deque: Deque<Int> = []
+        timer.measure {
+          appendCollection(source, to: &deque)
+        }
+        precondition(deque.count == input.count)
+        blackHole(deque)
+      }
+    }
+
+    self.add(
+      title: "Deque<UInt8> append copying bytes",
+      input: Int.self
+    ) { size in
+      let bytes = [UInt8](repeating: 42, count: size)
+      return { timer in
+        var deque: Deque<UInt8> = []
+        timer.measure {
+          bytes.withUnsafeBytes { deque.append(copyingBytesFrom: $0) }
+        }
+        precondition(deque.count == size)
+        blackHole(deque)
+      }
+    }
+
+    self.add(
+      title: "Deque<UInt8> append bytes from array",
+      input: Int.self
+    ) { size in
+      let bytes = [UInt8](repeating: 42, count: size)
+      return { timer in
+        var deque: Deque<UInt8> = []
+        timer.measure {
+          deque.append(contentsOf: bytes)
+        }
+        precondition(deque.count == size)
+        blackHole(deque)
+      }
+    }
+
     self.addSimple(
       title: "Deque<Int> kalimba",
       input: [Int].self
@@ -478,6 +575,79 @@ extension Benchmark {
       }
     }
 
+    self.add(
+      title: "Deque<Int> removeFirst into buffer, batches of 64 (discontiguous)",
+      input: Int.self
+    ) { size in
+      return { timer in
+        var deque = Deque(discontiguous: Array(0 ..< size))
+        let batch = UnsafeMutableBufferPointer<Int>.allocate(capacity: 64)
+        defer { batch.deallocate() }
+        timer.measure {
+          while !deque.isEmpty {
+            let n = Swift.min(64, deque.count)
+            deque.removeFirst(n, into: batch)
+            blackHole(batch[n - 1])
+          }
+        }
+        precondition(deque.isEmpty)
+        blackHole(deque)
+      }
+    }
+
+    self.add(
+      title: "Deque<Int> spike and drain (default storage policy)",
+      input: Int.self
+    ) { size in
+      return { timer in
+        var deque: Deque<Int> = []
+        timer.measure {
+          for _ in 0 ..< 4 {
+            deque.append(contentsOf: 0 ..< size)
+            while let value = deque.popFirst() {
+              blackHole(value)
+            }
+          }
+        }
+        blackHole(deque)
+      }
+    }
+
+    self.add(
+      title: "Deque<Int> spike and drain (shrinking storage policy)",
+      input: Int.self
+    ) { size in
+      return { timer in
+        var deque: Deque<Int> = []
+        deque.storagePolicy = DequeStoragePolicy(
+          shrinkThreshold: 0.25, minimumCapacity: 16)
+        timer.measure {
+          for _ in 0 ..< 4 {
+            deque.append(contentsOf: 0 ..< size)
+            while let value = deque.popFirst() {
+              blackHole(value)
+            }
+          }
+        }
+        blackHole(deque)
+      }
+    }
+
+    self.add(
+      title: "Deque<Int> shrinkToFit (discontiguous)",
+      input: Int.self
+    ) { size in
+      return { timer in
+        var deque = Deque(discontiguous: Array(0 ..< 2 * size))
+        deque.removeLast(size)
+        timer.measure {
+          deque.shrinkToFit()
+        }
+        precondition(deque.count == size)
+        blackHole(deque)
+      }
+    }
+
     self.add(
       title: "Deque<Int> random removals (contiguous)",
       input: Insertions.self
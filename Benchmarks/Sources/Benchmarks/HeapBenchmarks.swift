@@ -29,6 +29,13 @@ extension Benchmark {
       blackHole(Heap(input))
     }
 
+    self.addSimple(
+      title: "Heap<Int> init from buffer in parallel",
+      input: [Int].self
+    ) { input in
+      blackHole(Heap(parallelizing: input))
+    }
+
     self.addSimple(
       title: "Heap<Int> insert",
       input: [Int].self
@@ -53,6 +60,78 @@ extension Benchmark {
       }
     }
 
+    self.add(
+      title: "Heap<Int> insert batch one by one",
+      input: [Int].self
+    ) { input in
+      let existing = Heap(input[..<(input.count / 2)])
+      let batch = input[(input.count / 2)...]
+      return { timer in
+        var queue = existing
+        queue.reserveCapacity(input.count)
+        timer.measure {
+          for item in batch {
+            queue.insert(item)
+          }
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "Heap<Int> insert(contentsOf:) batch",
+      input: [Int].self
+    ) { input in
+      let existing = Heap(input[..<(input.count / 2)])
+      let batch = input[(input.count / 2)...]
+      return { timer in
+        var queue = existing
+        queue.reserveCapacity(input.count)
+        timer.measure {
+          queue.insert(contentsOf: batch)
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "Heap<Int> insert(contentsOf:) batches of 64",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = Heap<Int>(minimumCapacity: input.count)
+        timer.measure {
+          var start = 0
+          while start < input.count {
+            let end = Swift.min(start + 64, input.count)
+            queue.insert(contentsOf: input[start ..< end])
+            start = end
+          }
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "Heap<Int> merge",
+      input: [Int].self
+    ) { input in
+      let first = Heap(input[..<(input.count / 2)])
+      let second = Heap(input[(input.count / 2)...])
+      return { timer in
+        var queue = first
+        queue.reserveCapacity(input.count)
+        timer.measure {
+          queue.merge(second)
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
+
     self.add(
       title: "Heap<Int> popMax",
       input: [Int].self
@@ -84,5 +163,267 @@ extension Benchmark {
         blackHole(queue)
       }
     }
+
+    for k in [10, 100, 1000] {
+      self.addSimple(
+        title: "Heap<Int> top-\(k) via insert + popMin",
+        input: [Int].self
+      ) { input in
+        var queue = Heap<Int>()
+        for item in input {
+          queue.insert(item)
+          if queue.count > k {
+            blackHole(queue.popMin())
+          }
+        }
+        precondition(queue.count == Swift.min(k, input.count))
+        blackHole(queue)
+      }
+
+      self.addSimple(
+        title: "Heap<Int> top-\(k) via insert(_:keepingLargest:)",
+        input: [Int].self
+      ) { input in
+        var queue = Heap<Int>()
+        for item in input {
+          queue.insert(item, keepingLargest: k)
+        }
+        precondition(queue.count == Swift.min(k, input.count))
+        blackHole(queue)
+      }
+
+      self.addSimple(
+        title: "Heap<Int> top-\(k) via topK(_:of:)",
+        input: [Int].self
+      ) { input in
+        let queue = Heap.topK(k, of: input)
+        precondition(queue.count == Swift.min(k, input.count))
+        blackHole(queue)
+      }
+    }
+
+    self.addSimple(
+      title: "AddressableHeap<Int> insert",
+      input: [Int].self
+    ) { input in
+      var queue = AddressableHeap<Int>()
+      for i in input {
+        queue.insert(i)
+      }
+      precondition(queue.count == input.count)
+      blackHole(queue)
+    }
+
+    self.add(
+      title: "AddressableHeap<Int> popMin",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = AddressableHeap<Int>(minimumCapacity: input.count)
+        for i in input {
+          queue.insert(i)
+        }
+        timer.measure {
+          while let min = queue.popMin() {
+            blackHole(min)
+          }
+        }
+        precondition(queue.isEmpty)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "AddressableHeap<Int> decrease-key",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = AddressableHeap<Int>(minimumCapacity: input.count)
+        let handles = input.map { queue.insert($0 + input.count) }
+        timer.measure {
+          for (handle, value) in zip(handles, input) {
+            queue.update(handle, to: value)
+          }
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "Heap<Int> decrease-key by lazy reinsertion",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        // The workaround for the lack of handles: insert the new priority,
+        // and skip stale entries when they eventually reach the top.
+        var queue = Heap<Int>(minimumCapacity: 2 * input.count)
+        queue.insert(contentsOf: input.lazy.map { $0 + input.count })
+        timer.measure {
+          for value in input {
+            queue.insert(value)
+          }
+        }
+        precondition(queue.count == 2 * input.count)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "Heap<Int> replaceMin",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = Heap(input)
+        timer.measure {
+          for value in input {
+            queue.replaceMin(with: value + input.count)
+          }
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
+
+    self.addSimple(
+      title: "BlockedHeap<Int> init from buffer",
+      input: [Int].self
+    ) { input in
+      blackHole(BlockedHeap(input))
+    }
+
+    self.addSimple(
+      title: "BlockedHeap<Int> insert",
+      input: [Int].self
+    ) { input in
+      var queue = BlockedHeap<Int>()
+      for i in input {
+        queue.insert(i)
+      }
+      precondition(queue.count == input.count)
+      blackHole(queue)
+    }
+
+    self.add(
+      title: "BlockedHeap<Int> popMax",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = BlockedHeap(input)
+        timer.measure {
+          while let max = queue.popMax() {
+            blackHole(max)
+          }
+        }
+        precondition(queue.isEmpty)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "BlockedHeap<Int> popMin",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = BlockedHeap(input)
+        timer.measure {
+          while let min = queue.popMin() {
+            blackHole(min)
+          }
+        }
+        precondition(queue.isEmpty)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "BlockedHeap<Int> replaceMin",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = BlockedHeap(input)
+        timer.measure {
+          for value in input {
+            queue.replaceMin(with: value + input.count)
+          }
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "Heap<Int> monotone insert + popMin",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = Heap<Int>()
+        timer.measure {
+          for value in input {
+            queue.insert(value)
+          }
+          while let min = queue.popMin() {
+            blackHole(min)
+          }
+        }
+        precondition(queue.isEmpty)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "RadixHeap<UInt, Int> monotone insert + popMin",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = RadixHeap<UInt, Int>()
+        timer.measure {
+          for value in input {
+            queue.insert(key: UInt(value), value: value)
+          }
+          while let min = queue.popMin() {
+            blackHole(min)
+          }
+        }
+        precondition(queue.isEmpty)
+        blackHole(queue)
+      }
+    }
+
+    // An event scheduler in steady state: each step handles the earliest
+    // event, then schedules a new one a short random delay into the future.
+    self.add(
+      title: "Heap<Int> monotone popMin + reschedule",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = Heap(input)
+        timer.measure {
+          for delay in input {
+            let now = queue.removeMin()
+            queue.insert(now + delay % 1024)
+          }
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
+
+    self.add(
+      title: "RadixHeap<UInt, Int> monotone popMin + reschedule",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var queue = RadixHeap(input.lazy.map { (key: UInt($0), value: $0) })
+        timer.measure {
+          for delay in input {
+            let now = queue.removeMin()
+            queue.insert(key: now.key + UInt(delay % 1024), value: now.value)
+          }
+        }
+        precondition(queue.count == input.count)
+        blackHole(queue)
+      }
+    }
   }
 }
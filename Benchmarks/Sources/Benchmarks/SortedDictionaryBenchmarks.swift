@@ -12,6 +12,18 @@
 import CollectionsBenchmark
 import SortedCollections
 
+/// An integer key that sorted collections can only search with generic
+/// comparisons.
+struct ScalarSearchKey: Comparable {
+  var value: Int
+
+  init(_ value: Int) { self.value = value }
+
+  static func < (left: Self, right: Self) -> Bool {
+    left.value < right.value
+  }
+}
+
 extension Benchmark {
   public mutating func addSortedDictionaryBenchmarks() {
     self.add(
@@ -299,5 +311,296 @@ extension Benchmark {
         blackHole(d)
       }
     }
+
+    // Node capacity sweep. Every node in these trees holds up to `capacity`
+    // elements, regardless of the size of the key.
+    for capacity in [16, 32, 64, 128, 256, 512] {
+      self.add(
+        title: "SortedDictionary<Int, Int> insert (node capacity \(capacity))",
+        input: [Int].self
+      ) { input in
+        return { timer in
+          var d = SortedDictionary<Int, Int>(
+            leafCapacity: capacity, internalCapacity: capacity)
+          timer.measure {
+            for key in input {
+              d[key] = 2 * key
+            }
+          }
+          precondition(d.count == input.count)
+          blackHole(d)
+        }
+      }
+
+      self.add(
+        title: "SortedDictionary<Int, Int> successful lookups (node capacity \(capacity))",
+        input: ([Int], [Int]).self
+      ) { input, lookups in
+        let d = SortedDictionary(
+          sortedKeysWithValues: input.sorted().lazy.map { (key: $0, value: 2 * $0) },
+          leafCapacity: capacity,
+          internalCapacity: capacity)
+
+        return { timer in
+          for key in lookups {
+            precondition(d[key] == key * 2)
+          }
+        }
+      }
+
+      // The same lookups with keys that are searched with a scalar binary
+      // search, as a baseline for the vectorized search of `Int` keys.
+      self.add(
+        title: "SortedDictionary<ScalarSearchKey, Int> successful lookups (node capacity \(capacity))",
+        input: ([Int], [Int]).self
+      ) { input, lookups in
+        let d = SortedDictionary(
+          sortedKeysWithValues: input.sorted().lazy.map {
+            (key: ScalarSearchKey($0), value: 2 * $0)
+          },
+          leafCapacity: capacity,
+          internalCapacity: capacity)
+        let lookups = lookups.map { ScalarSearchKey($0) }
+
+        return { timer in
+          for key in lookups {
+            precondition(d[key] == key.value * 2)
+          }
+        }
+      }
+
+      self.add(
+        title: "SortedDictionary<Int, Int> sequential iteration (node capacity \(capacity))",
+        input: Int.self
+      ) { size in
+        let d = SortedDictionary(
+          sortedKeysWithValues: (0 ..< size).lazy.map { (key: $0, value: $0) },
+          leafCapacity: capacity,
+          internalCapacity: capacity)
+
+        return { timer in
+          for item in d {
+            blackHole(item)
+          }
+        }
+      }
+
+      self.add(
+        title: "SortedDictionary<Int, Int> remove (node capacity \(capacity))",
+        input: ([Int], [Int]).self
+      ) { input, removals in
+        return { timer in
+          var d = SortedDictionary(
+            sortedKeysWithValues: input.sorted().lazy.map { (key: $0, value: $0) },
+            leafCapacity: capacity,
+            internalCapacity: capacity)
+          timer.measure {
+            for key in removals {
+              d[key] = nil
+            }
+          }
+          precondition(d.isEmpty)
+          blackHole(d)
+        }
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> split(at:)",
+      input: Int.self
+    ) { size in
+      let d = SortedDictionary(
+        sortedKeysWithValues: (0 ..< size).lazy.map { (key: $0, value: $0) })
+
+      return { timer in
+        for key in stride(from: 0, to: size, by: Swift.max(1, size / 100)) {
+          blackHole(d.split(at: key))
+        }
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> split, then append(contentsOf:)",
+      input: Int.self
+    ) { size in
+      let d = SortedDictionary(
+        sortedKeysWithValues: (0 ..< size).lazy.map { (key: $0, value: $0) })
+
+      return { timer in
+        for key in stride(from: 0, to: size, by: Swift.max(1, size / 100)) {
+          let (lower, upper) = d.split(at: key)
+          var joined = lower
+          joined.append(contentsOf: upper)
+          blackHole(joined)
+        }
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> split by filtering",
+      input: Int.self
+    ) { size in
+      let d = SortedDictionary(
+        sortedKeysWithValues: (0 ..< size).lazy.map { (key: $0, value: $0) })
+
+      return { timer in
+        for key in stride(from: 0, to: size, by: Swift.max(1, size / 100)) {
+          blackHole(d.filter { $0.key < key })
+          blackHole(d.filter { $0.key >= key })
+        }
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> removeSubrange(..<key), oldest 10%",
+      input: Int.self
+    ) { size in
+      let d = SortedDictionary(
+        sortedKeysWithValues: (0 ..< size).lazy.map { (key: $0, value: $0) })
+
+      return { timer in
+        var copy = d
+        timer.measure {
+          copy.removeSubrange(..<(size / 10))
+        }
+        precondition(copy.count == size - size / 10)
+        blackHole(copy)
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> removeFirst(_:), oldest 10%",
+      input: Int.self
+    ) { size in
+      let d = SortedDictionary(
+        sortedKeysWithValues: (0 ..< size).lazy.map { (key: $0, value: $0) })
+
+      return { timer in
+        var copy = d
+        timer.measure {
+          copy.removeFirst(size / 10)
+        }
+        precondition(copy.count == size - size / 10)
+        blackHole(copy)
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> extractSubrange(_:), middle half",
+      input: Int.self
+    ) { size in
+      let d = SortedDictionary(
+        sortedKeysWithValues: (0 ..< size).lazy.map { (key: $0, value: $0) })
+
+      return { timer in
+        var copy = d
+        timer.measure {
+          blackHole(copy.extractSubrange(size / 4 ..< 3 * size / 4))
+        }
+        blackHole(copy)
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> subscript, sorted batch of lookups",
+      input: ([Int], [Int]).self
+    ) { input, lookups in
+      let d = SortedDictionary(
+        keysWithValues: input.lazy.map { (key: $0, value: 2 * $0) })
+      let keys = lookups.sorted()
+
+      return { timer in
+        var result: [Int?] = []
+        result.reserveCapacity(keys.count)
+        timer.measure {
+          for key in keys {
+            result.append(d[key])
+          }
+        }
+        blackHole(result)
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> values(forSortedKeys:)",
+      input: ([Int], [Int]).self
+    ) { input, lookups in
+      let d = SortedDictionary(
+        keysWithValues: input.lazy.map { (key: $0, value: 2 * $0) })
+      let keys = lookups.sorted()
+
+      return { timer in
+        blackHole(d.values(forSortedKeys: keys))
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> subscript, setter ascending keys",
+      input: Int.self
+    ) { size in
+      return { timer in
+        var d = SortedDictionary<Int, Int>()
+        timer.measure {
+          for key in 0 ..< size {
+            d[key] = key
+          }
+        }
+        blackHole(d)
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> append(_:)",
+      input: Int.self
+    ) { size in
+      return { timer in
+        var d = SortedDictionary<Int, Int>()
+        timer.measure {
+          for key in 0 ..< size {
+            d.append((key: key, value: key))
+          }
+        }
+        blackHole(d)
+      }
+    }
+
+    // Node allocation heavy workloads: churn splits and merges nodes over and
+    // over, and bulk builds with small nodes allocate many of them.
+    self.add(
+      title: "SortedDictionary<Int, Int> insert/remove churn",
+      input: [Int].self
+    ) { input in
+      let d = SortedDictionary(
+        keysWithValues: input.lazy.map { (key: 2 * $0, value: $0) })
+      return { timer in
+        var d = d
+        timer.measure {
+          for key in input {
+            d[2 * key + 1] = key
+            d[2 * key] = nil
+          }
+          for key in input {
+            d[2 * key] = key
+            d[2 * key + 1] = nil
+          }
+        }
+        precondition(d.count == input.count)
+        blackHole(d)
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> init(sortedKeysWithValues:) (node capacity 16)",
+      input: Int.self
+    ) { input in
+      let keysAndValues = (0..<input).lazy.map { (key: $0, value: 2 * $0) }
+
+      return { timer in
+        blackHole(SortedDictionary(
+          sortedKeysWithValues: keysAndValues,
+          leafCapacity: 16,
+          internalCapacity: 16))
+      }
+    }
   }
 }
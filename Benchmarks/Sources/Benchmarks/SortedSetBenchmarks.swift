@@ -203,5 +203,79 @@ extension Benchmark {
       }
     }
 
+    let ratios: [(String, (Int) -> Int)] = [
+      ("1/10",   { c in c / 10 }),
+      ("1/100",  { c in c / 100 }),
+      ("1/1000", { c in c / 1000 }),
+    ]
+
+    // SetAlgebra operations with a much smaller Self
+    do {
+      for (ratio, size) in ratios {
+        self.add(
+          title: "SortedSet<Int> union with Self (\(ratio) size)",
+          input: [Int].self
+        ) { input in
+          let a = SortedSet(input)
+          let b = SortedSet(input.prefix(size(input.count)).map { 2 * $0 })
+          return { timer in
+            blackHole(a.union(b))
+          }
+        }
+      }
+
+      for (ratio, size) in ratios {
+        self.add(
+          title: "SortedSet<Int> intersection with Self (\(ratio) size)",
+          input: [Int].self
+        ) { input in
+          let a = SortedSet(input)
+          let b = SortedSet(input.prefix(size(input.count)).map { 2 * $0 })
+          return { timer in
+            blackHole(a.intersection(b))
+          }
+        }
+      }
+
+      for (ratio, size) in ratios {
+        self.add(
+          title: "SortedSet<Int> symmetricDifference with Self (\(ratio) size)",
+          input: [Int].self
+        ) { input in
+          let a = SortedSet(input)
+          let b = SortedSet(input.prefix(size(input.count)).map { 2 * $0 })
+          return { timer in
+            blackHole(a.symmetricDifference(b))
+          }
+        }
+      }
+
+      for (ratio, size) in ratios {
+        self.add(
+          title: "SortedSet<Int> subtracting Self (\(ratio) size)",
+          input: [Int].self
+        ) { input in
+          let a = SortedSet(input)
+          let b = SortedSet(input.prefix(size(input.count)).map { 2 * $0 })
+          return { timer in
+            blackHole(a.subtracting(b))
+          }
+        }
+      }
+
+      for (ratio, size) in ratios {
+        self.add(
+          title: "SortedSet<Int> isSubset of Self (\(ratio) size)",
+          input: [Int].self
+        ) { input in
+          let a = SortedSet(input)
+          let b = SortedSet(input.prefix(size(input.count)))
+          return { timer in
+            blackHole(b.isSubset(of: a))
+          }
+        }
+      }
+    }
+
   }
 }
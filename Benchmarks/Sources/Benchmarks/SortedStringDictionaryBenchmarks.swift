@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+
+import CollectionsBenchmark
+import SortedCollections
+
+/// Returns a file path with a long prefix shared by many other paths.
+func pathKey(_ i: Int) -> String {
+  "/var/lib/collections/objects/\(i % 256)/\(i)/index.json"
+}
+
+extension Benchmark {
+  public mutating func addSortedStringDictionaryBenchmarks() {
+    self.add(
+      title: "SortedStringDictionary<Int> random insertions (path keys)",
+      input: [Int].self
+    ) { input in
+      let keys = input.map(pathKey)
+      return { timer in
+        var d = SortedStringDictionary<Int>()
+        timer.measure {
+          for (key, value) in zip(keys, input) {
+            d[key] = value
+          }
+        }
+        precondition(d.count == input.count)
+        blackHole(d)
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<String, Int> random insertions (path keys)",
+      input: [Int].self
+    ) { input in
+      let keys = input.map(pathKey)
+      return { timer in
+        var d = SortedDictionary<String, Int>()
+        timer.measure {
+          for (key, value) in zip(keys, input) {
+            d[key] = value
+          }
+        }
+        precondition(d.count == input.count)
+        blackHole(d)
+      }
+    }
+
+    self.add(
+      title: "SortedStringDictionary<Int> successful lookups (path keys)",
+      input: ([Int], [Int]).self
+    ) { input, lookups in
+      let d = SortedStringDictionary<Int>(
+        keysWithValues: input.lazy.map { (pathKey($0), $0) })
+      let lookups = lookups.map { (pathKey($0), $0) }
+      return { timer in
+        for (key, value) in lookups {
+          precondition(d[key] == value)
+        }
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<String, Int> successful lookups (path keys)",
+      input: ([Int], [Int]).self
+    ) { input, lookups in
+      let d = SortedDictionary<String, Int>(
+        keysWithValues: input.lazy.map { (pathKey($0), $0) })
+      let lookups = lookups.map { (pathKey($0), $0) }
+      return { timer in
+        for (key, value) in lookups {
+          precondition(d[key] == value)
+        }
+      }
+    }
+
+    self.add(
+      title: "SortedStringDictionary<Int> iteration (path keys)",
+      input: [Int].self
+    ) { input in
+      let d = SortedStringDictionary<Int>(
+        keysWithValues: input.lazy.map { (pathKey($0), $0) })
+      return { timer in
+        for (key, value) in d {
+          blackHole((key, value))
+        }
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<String, Int> iteration (path keys)",
+      input: [Int].self
+    ) { input in
+      let d = SortedDictionary<String, Int>(
+        keysWithValues: input.lazy.map { (pathKey($0), $0) })
+      return { timer in
+        for (key, value) in d {
+          blackHole((key, value))
+        }
+      }
+    }
+  }
+}
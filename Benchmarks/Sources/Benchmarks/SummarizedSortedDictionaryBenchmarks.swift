@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+
+import CollectionsBenchmark
+import SortedCollections
+
+/// Sums the values in a `SummarizedSortedDictionary<Int, Int>`.
+struct IntSum: SortedDictionarySummary {
+  var sum: Int
+
+  static var zero: IntSum { IntSum(sum: 0) }
+
+  init(sum: Int) { self.sum = sum }
+  init(key: Int, value: Int) { self.sum = value }
+
+  mutating func add(_ other: IntSum) { sum &+= other.sum }
+}
+
+extension Benchmark {
+  public mutating func addSummarizedSortedDictionaryBenchmarks() {
+    self.add(
+      title: "SummarizedSortedDictionary<Int, Int> random insertions",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        var d = SummarizedSortedDictionary<IntSum>()
+        timer.measure {
+          for key in input {
+            d[key] = key
+          }
+        }
+        precondition(d.count == input.count)
+        blackHole(d)
+      }
+    }
+
+    self.add(
+      title: "SummarizedSortedDictionary<Int, Int> random removals",
+      input: [Int].self
+    ) { input in
+      let d = SummarizedSortedDictionary<IntSum>(
+        keysWithValues: input.lazy.map { ($0, $0) })
+      return { timer in
+        var copy = d
+        timer.measure {
+          for key in input {
+            copy.removeValue(forKey: key)
+          }
+        }
+        precondition(copy.isEmpty)
+        blackHole(copy)
+      }
+    }
+
+    self.add(
+      title: "SummarizedSortedDictionary<Int, Int> summary(of:), 100 random ranges",
+      input: Int.self
+    ) { size in
+      let d = SummarizedSortedDictionary<IntSum>(
+        keysWithValues: (0 ..< size).lazy.map { ($0, $0) })
+      var rng = SystemRandomNumberGenerator()
+      let ranges: [Range<Int>] = (0 ..< 100).map { _ in
+        let a = Int.random(in: 0 ... size, using: &rng)
+        let b = Int.random(in: 0 ... size, using: &rng)
+        return Swift.min(a, b) ..< Swift.max(a, b)
+      }
+      return { timer in
+        var total = 0
+        for range in ranges {
+          total &+= d.summary(of: range).sum
+        }
+        blackHole(total)
+      }
+    }
+
+    self.add(
+      title: "SortedDictionary<Int, Int> sum of values in range, 100 random ranges",
+      input: Int.self
+    ) { size in
+      let d = SortedDictionary(
+        sortedKeysWithValues: (0 ..< size).lazy.map { (key: $0, value: $0) })
+      var rng = SystemRandomNumberGenerator()
+      let ranges: [Range<Int>] = (0 ..< 100).map { _ in
+        let a = Int.random(in: 0 ... size, using: &rng)
+        let b = Int.random(in: 0 ... size, using: &rng)
+        return Swift.min(a, b) ..< Swift.max(a, b)
+      }
+      return { timer in
+        var total = 0
+        for range in ranges {
+          let start = d.index(forKey: range.lowerBound) ?? d.endIndex
+          var i = start
+          while i < d.endIndex && d[i].key < range.upperBound {
+            total &+= d[i].value
+            d.formIndex(after: &i)
+          }
+        }
+        blackHole(total)
+      }
+    }
+  }
+}
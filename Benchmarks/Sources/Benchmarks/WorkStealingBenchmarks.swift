@@ -0,0 +1,202 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import Foundation
+import Synchronization
+import CollectionsBenchmark
+import DequeModule
+
+/// The number of work units below which fork-join tasks stop splitting.
+internal let _forkJoinGrain = 64
+
+/// Process a leaf task consisting of `n` units of trivial work.
+@inline(never)
+internal func _forkJoinLeaf(_ n: Int) {
+  var x = 0
+  for i in 0 ..< n {
+    x &+= i &* i
+  }
+  blackHole(x)
+}
+
+/// A minimal fork-join scheduler with one work-stealing deque per worker.
+///
+/// A task is represented by the number of work units it covers. Workers split
+/// tasks in half until they reach `_forkJoinGrain`, pushing one half onto
+/// their own deque, and steal from their peers in round-robin order when they
+/// run out of work.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+internal final class _WorkStealingPool: Sendable {
+  internal let deques: [WorkStealingDeque<Int>]
+  internal let completed = Atomic<Int>(0)
+  internal let steals = Atomic<Int>(0)
+  internal let total: Int
+
+  internal init(workers: Int, total: Int) {
+    self.deques = (0 ..< workers).map { _ in WorkStealingDeque<Int>() }
+    self.total = total
+    deques[0].push(total)
+  }
+
+  internal func run(worker: Int) {
+    let own = deques[worker]
+    var victim = worker
+    while completed.load(ordering: .relaxed) < total {
+      var task = own.pop()
+      if task == nil, deques.count > 1 {
+        victim = (victim + 1) % deques.count
+        if victim == worker { continue }
+        task = deques[victim].steal()
+        if task != nil { steals.wrappingAdd(1, ordering: .relaxed) }
+      }
+      guard var n = task else { continue }
+      while n > _forkJoinGrain {
+        let half = n / 2
+        own.push(half)
+        n -= half
+      }
+      _forkJoinLeaf(n)
+      completed.wrappingAdd(n, ordering: .relaxed)
+    }
+  }
+}
+
+/// The same fork-join scheduler as `_WorkStealingPool`, but with a single
+/// lock-protected `Deque` shared between all workers.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+internal final class _SharedQueuePool: Sendable {
+  internal let queue = _LockedDeque<Int>()
+  internal let completed = Atomic<Int>(0)
+  internal let total: Int
+
+  internal init(total: Int) {
+    self.total = total
+    queue.append(total)
+  }
+
+  internal func run() {
+    while completed.load(ordering: .relaxed) < total {
+      guard var n = queue.popFirst() else { continue }
+      while n > _forkJoinGrain {
+        let half = n / 2
+        queue.append(half)
+        n -= half
+      }
+      _forkJoinLeaf(n)
+      completed.wrappingAdd(n, ordering: .relaxed)
+    }
+  }
+}
+
+extension Benchmark {
+  public mutating func addWorkStealingBenchmarks() {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      return
+    }
+
+    self.add(
+      title: "WorkStealingDeque<Int> push/pop (owner only)",
+      input: [Int].self
+    ) { input in
+      return { timer in
+        let deque = WorkStealingDeque<Int>()
+        timer.measure {
+          for i in input {
+            deque.push(i)
+          }
+          while let value = deque.pop() {
+            blackHole(value)
+          }
+        }
+      }
+    }
+
+    for threads in [2, 4, 8, 16] {
+      self.add(
+        title: "WorkStealingDeque<Int> steal throughput (\(threads - 1) thieves)",
+        input: Int.self
+      ) { size in
+        return { timer in
+          let deque = WorkStealingDeque<Int>()
+          let remaining = _AtomicCounter(size)
+          let owner: @Sendable () -> Void = {
+            for i in 0 ..< size {
+              deque.push(i)
+            }
+          }
+          let thief: @Sendable () -> Void = {
+            while remaining.value > 0 {
+              if let value = deque.steal() {
+                blackHole(value)
+                remaining.decrement()
+              }
+            }
+          }
+          timer.measure {
+            _runOnSeparateThreads(
+              [owner] + Array(repeating: thief, count: threads - 1))
+          }
+        }
+      }
+    }
+
+    for threads in [1, 2, 4, 8, 16] {
+      self.add(
+        title: "WorkStealingDeque<Int> fork-join (\(threads) threads)",
+        input: Int.self
+      ) { size in
+        return { timer in
+          let pool = _WorkStealingPool(workers: threads, total: size)
+          timer.measure {
+            _runOnSeparateThreads((0 ..< threads).map { worker in
+              let body: @Sendable () -> Void = { pool.run(worker: worker) }
+              return body
+            })
+          }
+          blackHole(pool.steals.load(ordering: .relaxed))
+        }
+      }
+
+      self.add(
+        title: "Deque<Int> with lock fork-join (\(threads) threads)",
+        input: Int.self
+      ) { size in
+        return { timer in
+          let pool = _SharedQueuePool(total: size)
+          timer.measure {
+            _runOnSeparateThreads(Array(repeating: {
+              pool.run()
+            }, count: threads))
+          }
+        }
+      }
+    }
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+internal final class _AtomicCounter: Sendable {
+  internal let _value: Atomic<Int>
+
+  internal init(_ value: Int) {
+    _value = Atomic(value)
+  }
+
+  internal var value: Int {
+    _value.load(ordering: .relaxed)
+  }
+
+  internal func decrement() {
+    _value.wrappingSubtract(1, ordering: .relaxed)
+  }
+}
+#endif
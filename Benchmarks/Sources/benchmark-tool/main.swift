@@ -31,10 +31,17 @@ benchmark.addSetBenchmarks()
 benchmark.addDictionaryBenchmarks()
 benchmark.addTreeDictionaryBenchmarks()
 benchmark.addDequeBenchmarks()
+#if compiler(>=6.0) && canImport(Synchronization)
+benchmark.addConcurrentQueueBenchmarks()
+benchmark.addWorkStealingBenchmarks()
+benchmark.addConcurrentSortedDictionaryBenchmarks()
+#endif
 benchmark.addOrderedSetBenchmarks()
 benchmark.addOrderedDictionaryBenchmarks()
 benchmark.addSortedSetBenchmarks()
 benchmark.addSortedDictionaryBenchmarks()
+benchmark.addSummarizedSortedDictionaryBenchmarks()
+benchmark.addSortedStringDictionaryBenchmarks()
 benchmark.addHeapBenchmarks()
 benchmark.addBitSetBenchmarks()
 benchmark.addTreeSetBenchmarks()
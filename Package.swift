@@ -191,6 +191,7 @@ let targets: [CustomTarget] = [
       "Compatibility/UnsafeMutableBufferPointer+SE-0370.swift.gyb",
       "Compatibility/UnsafeMutablePointer+SE-0370.swift.gyb",
       "Compatibility/UnsafeRawPointer extensions.swift.gyb",
+      "Concurrency Helpers.swift.gyb",
       "Debugging.swift.gyb",
       "Descriptions.swift.gyb",
       "IntegerTricks/FixedWidthInteger+roundUpToPowerOfTwo.swift.gyb",
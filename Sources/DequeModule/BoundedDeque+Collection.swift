@@ -0,0 +1,206 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+extension BoundedDeque: Sequence {
+  public typealias Iterator = Deque<Element>.Iterator
+
+  /// Returns an iterator over the elements of the deque.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public func makeIterator() -> Iterator {
+    _base.makeIterator()
+  }
+
+  @inlinable
+  public var underestimatedCount: Int { _base.count }
+
+  @inlinable
+  public __consuming func _copyToContiguousArray() -> ContiguousArray<Element> {
+    _base._copyToContiguousArray()
+  }
+
+  @inlinable
+  public __consuming func _copyContents(
+    initializing target: UnsafeMutableBufferPointer<Element>
+  ) -> (Iterator, UnsafeMutableBufferPointer<Element>.Index) {
+    _base._copyContents(initializing: target)
+  }
+
+  /// Call `body(b)`, where `b` is an unsafe buffer pointer to the deque's
+  /// contiguous storage, if available. If the deque's contents aren't stored
+  /// contiguously, `body` is not called and `nil` is returned. The supplied
+  /// buffer pointer is only valid for the duration of the call.
+  ///
+  /// - Parameters:
+  ///   - body: The function to invoke.
+  ///
+  /// - Returns: The value returned by `body`, or `nil` if `body` wasn't called.
+  ///
+  /// - Complexity: O(1) (not counting the call to `body`).
+  @inlinable
+  public func withContiguousStorageIfAvailable<R>(
+    _ body: (UnsafeBufferPointer<Element>) throws -> R
+  ) rethrows -> R? {
+    try _base.withContiguousStorageIfAvailable(body)
+  }
+}
+
+extension BoundedDeque: RandomAccessCollection {
+  public typealias Index = Int
+  public typealias SubSequence = Slice<Self>
+  public typealias Indices = Range<Int>
+
+  /// The number of elements in the deque.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  @inline(__always)
+  public var count: Int { _base.count }
+
+  /// The position of the first element in a nonempty deque. This is always
+  /// zero.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  @inline(__always)
+  public var startIndex: Int { 0 }
+
+  /// The deque's "past the end" position. This is always equal to `count`.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  @inline(__always)
+  public var endIndex: Int { _base.count }
+
+  /// The indices that are valid for subscripting this deque, in ascending order.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  @inline(__always)
+  public var indices: Range<Int> { 0 ..< count }
+
+  @inlinable
+  @inline(__always)
+  public func index(after i: Int) -> Int { i + 1 }
+
+  @inlinable
+  @inline(__always)
+  public func formIndex(after i: inout Int) { i += 1 }
+
+  @inlinable
+  @inline(__always)
+  public func index(before i: Int) -> Int { i - 1 }
+
+  @inlinable
+  @inline(__always)
+  public func formIndex(before i: inout Int) { i -= 1 }
+
+  @inlinable
+  @inline(__always)
+  public func index(_ i: Int, offsetBy distance: Int) -> Int { i + distance }
+
+  @inlinable
+  public func index(
+    _ i: Int,
+    offsetBy distance: Int,
+    limitedBy limit: Int
+  ) -> Int? {
+    _base.index(i, offsetBy: distance, limitedBy: limit)
+  }
+
+  @inlinable
+  @inline(__always)
+  public func distance(from start: Int, to end: Int) -> Int { end - start }
+
+  /// Accesses the element at the specified position.
+  ///
+  /// - Parameters:
+  ///   - index: The position of the element to access. `index` must be greater
+  ///      than or equal to `startIndex` and less than `endIndex`.
+  ///
+  /// - Complexity: Reading an element from a deque is O(1). Writing is O(1)
+  ///    unless the deque's storage is shared with another deque, in which case
+  ///    writing is O(`count`).
+  @inlinable
+  public subscript(index: Int) -> Element {
+    get {
+      _base[index]
+    }
+    set {
+      _base[index] = newValue
+    }
+    _modify {
+      yield &_base[index]
+    }
+  }
+}
+
+extension BoundedDeque: MutableCollection {
+  /// Exchanges the values at the specified indices of the collection.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  public mutating func swapAt(_ i: Int, _ j: Int) {
+    _base.swapAt(i, j)
+  }
+
+  @inlinable
+  public mutating func withContiguousMutableStorageIfAvailable<R>(
+    _ body: (inout UnsafeMutableBufferPointer<Element>) throws -> R
+  ) rethrows -> R? {
+    try _base.withContiguousMutableStorageIfAvailable(body)
+  }
+}
+
+extension BoundedDeque: Equatable where Element: Equatable {
+  /// Returns a Boolean value indicating whether two values are equal. Two
+  /// bounded deques are considered equal if they contain the same elements in
+  /// the same order, regardless of their capacities.
+  ///
+  /// - Complexity: O(`min(left.count, right.count)`)
+  @inlinable
+  public static func ==(left: Self, right: Self) -> Bool {
+    left._base == right._base
+  }
+}
+
+extension BoundedDeque: Hashable where Element: Hashable {
+  /// Hashes the essential components of this value by feeding them into the
+  /// given hasher.
+  ///
+  /// Complexity: O(`count`)
+  @inlinable
+  public func hash(into hasher: inout Hasher) {
+    _base.hash(into: &hasher)
+  }
+}
+
+extension BoundedDeque: CustomStringConvertible {
+  /// A textual representation of this instance.
+  public var description: String {
+    _arrayDescription(for: self)
+  }
+}
+
+extension BoundedDeque: CustomDebugStringConvertible {
+  /// A textual representation of this instance, suitable for debugging.
+  public var debugDescription: String {
+    description
+  }
+}
+
+extension BoundedDeque: @unchecked Sendable where Element: Sendable {}
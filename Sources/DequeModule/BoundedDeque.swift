@@ -0,0 +1,282 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A double-ended queue with a fixed capacity, implemented as a ring buffer
+/// that never reallocates its storage.
+///
+/// `BoundedDeque` uses the same circular storage layout as `Deque`, but its
+/// capacity is chosen once, at initialization time, and it stays the same for
+/// the lifetime of the value. Instead of growing when it fills up, a bounded
+/// deque lets you choose how to handle the overflow:
+///
+/// - `tryAppend(_:)` and `tryPrepend(_:)` refuse to insert new elements into a
+///   full deque, which is useful for implementing backpressure.
+/// - `appendOverwritingFirst(_:)` and `prependOverwritingLast(_:)` evict the
+///   element at the opposite end to make room, which is useful for keeping a
+///   sliding window over the most recent items of a stream (such as telemetry
+///   samples).
+///
+///     var window = BoundedDeque<Int>(capacity: 3)
+///     for sample in 1 ... 5 {
+///       window.appendOverwritingFirst(sample)
+///     }
+///     print(window) // [3, 4, 5]
+///
+/// Like `Deque`, bounded deques implement value semantics with the
+/// copy-on-write optimization. Copying storage preserves capacity, so
+/// mutations never change the capacity of a bounded deque.
+@frozen
+public struct BoundedDeque<Element> {
+  @usableFromInline
+  internal var _base: Deque<Element>
+
+  @inlinable
+  internal init(_base: Deque<Element>) {
+    self._base = _base
+  }
+
+  /// Creates an empty bounded deque that is able to hold exactly `capacity`
+  /// elements.
+  ///
+  /// - Parameter capacity: The maximum number of elements the new deque can
+  ///    hold. `capacity` must be zero or greater.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public init(capacity: Int) {
+    precondition(capacity >= 0, "Capacity must not be negative")
+    self._base = Deque<Element>(
+      _storage: Deque<Element>._Storage(exactCapacity: capacity))
+  }
+
+  /// Creates a bounded deque with the specified capacity, containing the
+  /// elements of a sequence.
+  ///
+  /// - Parameters:
+  ///   - elements: The sequence of elements to turn into a bounded deque. The
+  ///      sequence must not contain more than `capacity` elements.
+  ///   - capacity: The maximum number of elements the new deque can hold.
+  ///
+  /// - Complexity: O(`capacity`)
+  @inlinable
+  public init(_ elements: some Sequence<Element>, capacity: Int) {
+    self.init(capacity: capacity)
+    for element in elements {
+      let success = tryAppend(element)
+      precondition(success, "Too many elements for capacity")
+    }
+  }
+}
+
+extension BoundedDeque {
+  /// The total number of elements that the deque can contain.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var capacity: Int {
+    _base._storage.capacity
+  }
+
+  /// A Boolean value indicating whether the deque has no more room for new
+  /// elements.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var isFull: Bool {
+    _base._storage.read { $0.count == $0.capacity }
+  }
+}
+
+extension BoundedDeque {
+  /// Adds a new element at the end of the deque, unless it is already full.
+  ///
+  ///     var queue = BoundedDeque<Int>(capacity: 2)
+  ///     queue.tryAppend(1) // true
+  ///     queue.tryAppend(2) // true
+  ///     queue.tryAppend(3) // false
+  ///     print(queue) // [1, 2]
+  ///
+  /// - Parameter newElement: The element to append to the deque.
+  ///
+  /// - Returns: True if the element was appended; false if the deque was
+  ///    already full, in which case it remains unchanged.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  public mutating func tryAppend(_ newElement: Element) -> Bool {
+    guard !isFull else { return false }
+    // This never needs to grow the storage buffer; at most it makes a copy of
+    // it with the same capacity.
+    _base.append(newElement)
+    return true
+  }
+
+  /// Adds a new element at the front of the deque, unless it is already full.
+  ///
+  /// - Parameter newElement: The element to prepend to the deque.
+  ///
+  /// - Returns: True if the element was prepended; false if the deque was
+  ///    already full, in which case it remains unchanged.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  public mutating func tryPrepend(_ newElement: Element) -> Bool {
+    guard !isFull else { return false }
+    _base.prepend(newElement)
+    return true
+  }
+
+  /// Adds a new element at the end of the deque. If the deque is full, then
+  /// its first (i.e., oldest) element is removed to make room for the new one.
+  ///
+  ///     var recent = BoundedDeque<Int>(capacity: 2)
+  ///     recent.appendOverwritingFirst(1) // nil
+  ///     recent.appendOverwritingFirst(2) // nil
+  ///     recent.appendOverwritingFirst(3) // 1
+  ///     print(recent) // [2, 3]
+  ///
+  /// If the deque has zero capacity, then it cannot hold any elements, and
+  /// `newElement` is returned immediately.
+  ///
+  /// - Parameter newElement: The element to append to the deque.
+  ///
+  /// - Returns: The element that was evicted to make room for `newElement`, or
+  ///    `nil` if the deque wasn't full.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  @discardableResult
+  public mutating func appendOverwritingFirst(
+    _ newElement: Element
+  ) -> Element? {
+    guard isFull else {
+      _base.append(newElement)
+      return nil
+    }
+    guard capacity > 0 else { return newElement }
+    _base._storage.ensureUnique()
+    return _base._storage.update { $0.uncheckedAppendEvictingFirst(newElement) }
+  }
+
+  /// Adds a new element at the front of the deque. If the deque is full, then
+  /// its last element is removed to make room for the new one.
+  ///
+  /// If the deque has zero capacity, then it cannot hold any elements, and
+  /// `newElement` is returned immediately.
+  ///
+  /// - Parameter newElement: The element to prepend to the deque.
+  ///
+  /// - Returns: The element that was evicted to make room for `newElement`, or
+  ///    `nil` if the deque wasn't full.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  @discardableResult
+  public mutating func prependOverwritingLast(
+    _ newElement: Element
+  ) -> Element? {
+    guard isFull else {
+      _base.prepend(newElement)
+      return nil
+    }
+    guard capacity > 0 else { return newElement }
+    _base._storage.ensureUnique()
+    return _base._storage.update { $0.uncheckedPrependEvictingLast(newElement) }
+  }
+}
+
+extension BoundedDeque {
+  /// Removes and returns the first element of the deque, if it exists.
+  ///
+  /// - Returns: The first element of the deque if it isn't empty; otherwise,
+  ///    `nil`.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  public mutating func popFirst() -> Element? {
+    _base.popFirst()
+  }
+
+  /// Removes and returns the last element of the deque, if it exists.
+  ///
+  /// - Returns: The last element of the deque if it isn't empty; otherwise,
+  ///    `nil`.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  public mutating func popLast() -> Element? {
+    _base.popLast()
+  }
+
+  /// Removes and returns the first element of the deque.
+  ///
+  /// The deque must not be empty.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  @discardableResult
+  public mutating func removeFirst() -> Element {
+    _base.removeFirst()
+  }
+
+  /// Removes and returns the last element of the deque.
+  ///
+  /// The deque must not be empty.
+  ///
+  /// - Complexity: O(1) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  @discardableResult
+  public mutating func removeLast() -> Element {
+    _base.removeLast()
+  }
+
+  /// Removes the specified number of elements from the beginning of the deque.
+  ///
+  /// - Parameter n: The number of elements to remove. `n` must be greater than
+  ///    or equal to zero and must not exceed the number of elements in the
+  ///    deque.
+  ///
+  /// - Complexity: O(`n`) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  public mutating func removeFirst(_ n: Int) {
+    _base.removeFirst(n)
+  }
+
+  /// Removes the specified number of elements from the end of the deque.
+  ///
+  /// - Parameter n: The number of elements to remove. `n` must be greater than
+  ///    or equal to zero and must not exceed the number of elements in the
+  ///    deque.
+  ///
+  /// - Complexity: O(`n`) when this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  public mutating func removeLast(_ n: Int) {
+    _base.removeLast(n)
+  }
+
+  /// Removes all elements from the deque, preserving its capacity.
+  ///
+  /// - Complexity: O(`count`)
+  @inlinable
+  public mutating func removeAll() {
+    _base.removeAll(keepingCapacity: true)
+  }
+}
@@ -442,8 +442,32 @@ extension Deque: MutableCollection {
     }
   }
 
-  // FIXME: Implement `partition(by:)` by making storage contiguous,
-  // and partitioning that.
+  /// Reorders the elements of the deque such that all the elements that match
+  /// the given predicate are after all the elements that don't match.
+  ///
+  /// The deque's contents are first rearranged into a single contiguous
+  /// region of its storage buffer (if they aren't already), then partitioned
+  /// directly in that buffer.
+  ///
+  /// - Parameter belongsInSecondPartition: A predicate used to partition the
+  ///    deque. All elements satisfying this predicate are ordered after all
+  ///    elements not satisfying it.
+  ///
+  /// - Returns: The index of the first element in the reordered deque that
+  ///    matches `belongsInSecondPartition`. If no elements in the deque match,
+  ///    the returned index is equal to the deque's `endIndex`.
+  ///
+  /// - Complexity: O(`count`)
+  @inlinable
+  public mutating func partition(
+    by belongsInSecondPartition: (Element) throws -> Bool
+  ) rethrows -> Int {
+    guard count > 0 else { return 0 }
+    return try _withContiguousElements { buffer in
+      var buffer = buffer
+      return try buffer.partition(by: belongsInSecondPartition)
+    }
+  }
 
   /// Call `body(b)`, where `b` is an unsafe buffer pointer to the deque's
   /// mutable contiguous storage. If the deque's contents aren't stored
@@ -573,6 +597,9 @@ extension Deque: RangeReplaceableCollection {
           atOffset: targetCut)
       }
     }
+    if deltaCount < 0 {
+      _storage.shrinkIfNeeded()
+    }
   }
 
   /// Creates a new deque containing the specified number of a single, repeated
@@ -825,14 +852,15 @@ extension Deque: RangeReplaceableCollection {
   @discardableResult
   public mutating func remove(at index: Int) -> Element {
     precondition(index >= 0 && index < self.count, "Index out of bounds")
-    // FIXME: Implement storage shrinking
     _storage.ensureUnique()
-    return _storage.update { target in
+    let result = _storage.update { target in
       // FIXME: Add direct implementation & see if it makes a difference
       let result = self[index]
       target.uncheckedRemove(offsets: index ..< index + 1)
       return result
     }
+    _storage.shrinkIfNeeded()
+    return result
   }
 
   /// Removes the elements in the specified subrange from the deque.
@@ -854,13 +882,16 @@ extension Deque: RangeReplaceableCollection {
                  "Index range out of bounds")
     _storage.ensureUnique()
     _storage.update { $0.uncheckedRemove(offsets: bounds) }
+    _storage.shrinkIfNeeded()
   }
 
   @inlinable
   public mutating func _customRemoveLast() -> Element? {
     precondition(!isEmpty, "Cannot remove last element of an empty Deque")
     _storage.ensureUnique()
-    return _storage.update { $0.uncheckedRemoveLast() }
+    let result = _storage.update { $0.uncheckedRemoveLast() }
+    _storage.shrinkIfNeeded()
+    return result
   }
 
   @inlinable
@@ -869,6 +900,7 @@ extension Deque: RangeReplaceableCollection {
     precondition(n <= count, "Can't remove more elements than there are in the Collection")
     _storage.ensureUnique()
     _storage.update { $0.uncheckedRemoveLast(n) }
+    _storage.shrinkIfNeeded()
     return true
   }
 
@@ -885,7 +917,9 @@ extension Deque: RangeReplaceableCollection {
   public mutating func removeFirst() -> Element {
     precondition(!isEmpty, "Cannot remove first element of an empty Deque")
     _storage.ensureUnique()
-    return _storage.update { $0.uncheckedRemoveFirst() }
+    let result = _storage.update { $0.uncheckedRemoveFirst() }
+    _storage.shrinkIfNeeded()
+    return result
   }
 
   /// Removes the specified number of elements from the beginning of the deque.
@@ -901,13 +935,15 @@ extension Deque: RangeReplaceableCollection {
     precondition(n >= 0, "Can't remove a negative number of elements")
     precondition(n <= count, "Can't remove more elements than there are in the Collection")
     _storage.ensureUnique()
-    return _storage.update { $0.uncheckedRemoveFirst(n) }
+    _storage.update { $0.uncheckedRemoveFirst(n) }
+    _storage.shrinkIfNeeded()
   }
 
   /// Removes all elements from the deque.
   ///
   /// - Parameter keepCapacity: Pass true to keep the existing storage capacity
   ///    of the deque after removing its elements. The default value is false.
+  ///    When this is false, the deque keeps its storage policy.
   ///
   /// - Complexity: O(`count`)
   @inlinable
@@ -916,7 +952,12 @@ extension Deque: RangeReplaceableCollection {
       _storage.ensureUnique()
       _storage.update { $0.uncheckedRemoveAll() }
     } else {
-      self = Deque()
+      let policy = _storage.policy
+      if policy == .default {
+        self = Deque()
+      } else {
+        self = Deque(_storage: _Storage(minimumCapacity: 0, policy: policy))
+      }
     }
   }
 }
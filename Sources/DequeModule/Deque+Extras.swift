@@ -77,9 +77,11 @@ extension Deque {
     // where Self == Self.SubSequence
     guard count > 0 else { return nil }
     _storage.ensureUnique()
-    return _storage.update {
+    let result = _storage.update {
       $0.uncheckedRemoveFirst()
     }
+    _storage.shrinkIfNeeded()
+    return result
   }
 
   // Note: `popLast` is implemented by the stdlib as a
@@ -190,3 +192,348 @@ extension Deque {
     }
   }
 }
+
+extension Deque {
+  /// Calls the given closure with unsafe buffer pointers covering the deque's
+  /// contents, in order.
+  ///
+  /// Deques store their elements in a circular buffer, so their contents may
+  /// be split into two contiguous regions. `body` receives both: the
+  /// elements of the deque are the elements of `first` followed by the
+  /// elements of `second`. When the contents aren't wrapped around the end of
+  /// the storage buffer, `second` is empty.
+  ///
+  /// This is useful for passing the contents of a deque to vectored I/O
+  /// operations (such as `writev`) without copying them into a contiguous
+  /// array first.
+  ///
+  /// The buffer pointers are only valid for the duration of the call.
+  ///
+  /// - Parameter body: A closure that receives the two regions of the deque.
+  ///
+  /// - Returns: The value returned by `body`.
+  ///
+  /// - Complexity: O(1) (not counting the call to `body`).
+  @inlinable
+  public func withUnsafeSegments<R>(
+    _ body: (
+      _ first: UnsafeBufferPointer<Element>,
+      _ second: UnsafeBufferPointer<Element>
+    ) throws -> R
+  ) rethrows -> R {
+    try _storage.read { handle in
+      let segments = handle.segments()
+      return try body(
+        segments.first,
+        segments.second ?? UnsafeBufferPointer(start: nil, count: 0))
+    }
+  }
+
+  /// Calls the given closure with unsafe buffer pointers covering the deque's
+  /// contents, then removes as many elements from the front of the deque as
+  /// the closure reports to have consumed.
+  ///
+  /// The elements of the deque are the elements of `first` followed by the
+  /// elements of `second`; `second` is empty unless the contents wrap around
+  /// the end of the storage buffer. The closure must not move or deinitialize
+  /// the elements it is given: the deque deinitializes consumed elements on its
+  /// own once the closure returns.
+  ///
+  /// For example, this drains a byte buffer into a socket using `writev`,
+  /// without staging its contents through an intermediate array:
+  ///
+  ///     var pending: Deque<UInt8> = ...
+  ///     try pending.removeFirst(consumingSegmentsWith: { first, second in
+  ///       var iov = [
+  ///         iovec(iov_base: UnsafeMutableRawPointer(mutating: first.baseAddress),
+  ///               iov_len: first.count),
+  ///         iovec(iov_base: UnsafeMutableRawPointer(mutating: second.baseAddress),
+  ///               iov_len: second.count),
+  ///       ]
+  ///       let written = writev(fd, &iov, 2)
+  ///       guard written >= 0 else { throw Errno(errno) }
+  ///       return written
+  ///     })
+  ///
+  /// If `body` throws an error, then the deque is left unchanged.
+  ///
+  /// - Parameter body: A closure that receives the two regions holding the
+  ///    contents of the deque and returns the number of elements it consumed
+  ///    from their start. The returned value must be between zero and the
+  ///    deque's original count, inclusive.
+  ///
+  /// - Returns: The number of elements that were removed.
+  ///
+  /// - Complexity: O(*n*), where *n* is the number of elements consumed, if the
+  ///    underlying storage isn't shared; otherwise O(`count`). (Not counting
+  ///    the call to `body`.)
+  @inlinable
+  @discardableResult
+  public mutating func removeFirst(
+    consumingSegmentsWith body: (
+      _ first: UnsafeBufferPointer<Element>,
+      _ second: UnsafeBufferPointer<Element>
+    ) throws -> Int
+  ) rethrows -> Int {
+    let consumed = try withUnsafeSegments(body)
+    precondition(consumed >= 0 && consumed <= count,
+                 "Consumed count out of bounds")
+    guard consumed > 0 else { return 0 }
+    _storage.ensureUnique()
+    _storage.update { $0.uncheckedRemoveFirst(consumed) }
+    _storage.shrinkIfNeeded()
+    return consumed
+  }
+
+  /// Ensures that the deque has room for at least `maximumCount` new elements
+  /// at its end, then calls the given closure to initialize some or all of
+  /// them in place.
+  ///
+  /// The free space at the end of the deque may be split into two contiguous
+  /// regions, as the storage buffer is circular. `body` receives both; taken
+  /// together, `first` and `second` cover exactly `maximumCount` uninitialized
+  /// slots. (`second` is empty if the free space isn't wrapped.)
+  ///
+  /// Inside the closure, the elements must be initialized in order, filling
+  /// `first` before moving on to `second`, and `initializedCount` must be set
+  /// to the total number of elements initialized. This matches the way vectored
+  /// input operations such as `readv` fill the buffers they are given, so this
+  /// method can be used to read data directly into a deque of bytes:
+  ///
+  ///     var incoming: Deque<UInt8> = []
+  ///     let n = try incoming.append(
+  ///       unsafeUninitializedCapacity: 4096,
+  ///       initializingWith: { first, second, initializedCount in
+  ///         var iov = [
+  ///           iovec(iov_base: first.baseAddress, iov_len: first.count),
+  ///           iovec(iov_base: second.baseAddress, iov_len: second.count),
+  ///         ]
+  ///         let read = readv(fd, &iov, 2)
+  ///         guard read >= 0 else { throw Errno(errno) }
+  ///         initializedCount = read
+  ///         return read
+  ///       })
+  ///
+  /// Once the closure returns, the deque's count is increased by
+  /// `initializedCount`. The initialized elements must form a prefix of the
+  /// two buffers taken together, and the rest of the memory they cover must
+  /// remain uninitialized. These postconditions must hold even if the closure
+  /// throws an error.
+  ///
+  /// - Parameters:
+  ///   - maximumCount: The number of uninitialized slots to make available
+  ///      to `body`. This must be zero or greater.
+  ///   - body: A closure that initializes new elements and sets their count.
+  ///     - Parameters:
+  ///       - first: The first region of uninitialized memory.
+  ///       - second: The second region of uninitialized memory, which
+  ///         logically follows `first`.
+  ///       - initializedCount: The number of elements initialized by `body`.
+  ///         This begins as zero and must not exceed `maximumCount`.
+  ///
+  /// - Returns: The value returned by `body`.
+  ///
+  /// - Complexity: Amortized O(`maximumCount`) (not counting the call to
+  ///    `body`).
+  @inlinable
+  public mutating func append<R>(
+    unsafeUninitializedCapacity maximumCount: Int,
+    initializingWith body: (
+      _ first: UnsafeMutableBufferPointer<Element>,
+      _ second: UnsafeMutableBufferPointer<Element>,
+      _ initializedCount: inout Int
+    ) throws -> R
+  ) rethrows -> R {
+    precondition(maximumCount >= 0, "Capacity must not be negative")
+    _storage.ensureUnique(minimumCapacity: count + maximumCount)
+    return try _storage.update { handle in
+      let gaps = handle.availableSegments().prefix(maximumCount)
+      let first = gaps.first
+      let second = gaps.second ?? UnsafeMutableBufferPointer(start: nil, count: 0)
+      assert(first.count + second.count == maximumCount)
+      var initializedCount = 0
+      defer {
+        precondition(
+          initializedCount >= 0 && initializedCount <= maximumCount,
+          "Initialized count out of bounds")
+        handle.count += initializedCount
+      }
+      return try body(first, second, &initializedCount)
+    }
+  }
+}
+
+extension Deque {
+  /// Adds the elements of another deque to the end of this deque.
+  ///
+  /// The contents of `newElements` are copied over in at most two bulk
+  /// operations, one for each contiguous region of its storage buffer.
+  ///
+  /// - Parameter newElements: The elements to append to the deque.
+  ///
+  /// - Complexity: Amortized O(`newElements.count`).
+  @inlinable
+  public mutating func append(contentsOf newElements: Deque<Element>) {
+    let c = newElements.count
+    guard c > 0 else { return }
+    _storage.ensureUnique(minimumCapacity: count + c)
+    newElements._storage.read { source in
+      let segments = source.segments()
+      _storage.update { target in
+        target.uncheckedAppend(contentsOf: segments.first)
+        if let second = segments.second {
+          target.uncheckedAppend(contentsOf: second)
+        }
+      }
+    }
+  }
+
+  /// Adds the elements of another deque to the front of this deque.
+  ///
+  /// The contents of `newElements` are copied over in at most two bulk
+  /// operations, one for each contiguous region of its storage buffer.
+  ///
+  /// - Parameter newElements: The elements to prepend to the deque.
+  ///
+  /// - Complexity: Amortized O(`newElements.count`).
+  @inlinable
+  public mutating func prepend(contentsOf newElements: Deque<Element>) {
+    let c = newElements.count
+    guard c > 0 else { return }
+    _storage.ensureUnique(minimumCapacity: count + c)
+    newElements._storage.read { source in
+      let segments = source.segments()
+      _storage.update { target in
+        if let second = segments.second {
+          target.uncheckedPrepend(contentsOf: second)
+        }
+        target.uncheckedPrepend(contentsOf: segments.first)
+      }
+    }
+  }
+}
+
+extension Deque {
+  /// Copy the raw bytes in `bytes` into the uninitialized slots of `gaps`.
+  @inlinable
+  internal static func _copyBytes(
+    _ bytes: UnsafeRawBufferPointer,
+    into gaps: _UnsafeMutableWrappedBuffer<Element>
+  ) {
+    let stride = MemoryLayout<Element>.stride
+    let firstByteCount = gaps.first.count * stride
+    UnsafeMutableRawPointer(gaps.first.baseAddress!).copyMemory(
+      from: bytes.baseAddress!, byteCount: firstByteCount)
+    if let second = gaps.second {
+      UnsafeMutableRawPointer(second.baseAddress!).copyMemory(
+        from: bytes.baseAddress! + firstByteCount,
+        byteCount: second.count * stride)
+    }
+  }
+
+  /// Adds elements to the end of the deque by copying their raw memory
+  /// representation from the given buffer.
+  ///
+  /// This is intended for filling deques of trivial types (such as `UInt8` or
+  /// other integers) from untyped sources, such as network or file buffers,
+  /// using bulk memory copies.
+  ///
+  ///     var incoming: Deque<UInt8> = []
+  ///     data.withUnsafeBytes { incoming.append(copyingBytesFrom: $0) }
+  ///
+  /// The source buffer does not need to be aligned for `Element`.
+  ///
+  /// - Parameter bytes: The raw bytes of the elements to append. `Element`
+  ///    must be a trivial type, and the size of `bytes` must be a multiple of
+  ///    `MemoryLayout<Element>.stride`.
+  ///
+  /// - Complexity: Amortized O(`bytes.count`).
+  @inlinable
+  public mutating func append(copyingBytesFrom bytes: UnsafeRawBufferPointer) {
+    precondition(_isPOD(Element.self), "Element must be a trivial type")
+    let stride = MemoryLayout<Element>.stride
+    precondition(bytes.count % stride == 0,
+                 "Byte count must be a multiple of the element stride")
+    let c = bytes.count / stride
+    guard c > 0 else { return }
+    _storage.ensureUnique(minimumCapacity: count + c)
+    _storage.update { target in
+      Self._copyBytes(bytes, into: target.availableSegments().prefix(c))
+      target.count += c
+    }
+  }
+
+  /// Adds elements to the front of the deque by copying their raw memory
+  /// representation from the given buffer.
+  ///
+  /// The source buffer does not need to be aligned for `Element`.
+  ///
+  /// - Parameter bytes: The raw bytes of the elements to prepend. `Element`
+  ///    must be a trivial type, and the size of `bytes` must be a multiple of
+  ///    `MemoryLayout<Element>.stride`.
+  ///
+  /// - Complexity: Amortized O(`bytes.count`).
+  @inlinable
+  public mutating func prepend(copyingBytesFrom bytes: UnsafeRawBufferPointer) {
+    precondition(_isPOD(Element.self), "Element must be a trivial type")
+    let stride = MemoryLayout<Element>.stride
+    precondition(bytes.count % stride == 0,
+                 "Byte count must be a multiple of the element stride")
+    let c = bytes.count / stride
+    guard c > 0 else { return }
+    _storage.ensureUnique(minimumCapacity: count + c)
+    _storage.update { target in
+      Self._copyBytes(bytes, into: target.availableSegments().suffix(c))
+      target.count += c
+      target.startSlot = target.slot(target.startSlot, offsetBy: -c)
+    }
+  }
+}
+
+extension Deque {
+  /// Removes the specified number of elements from the beginning of the
+  /// deque, moving them into the given buffer of uninitialized memory.
+  ///
+  /// The removed elements are moved in at most two bulk operations, one for
+  /// each contiguous region of the deque's storage buffer. On return, the
+  /// first `n` items of `target` are initialized, in their original order.
+  ///
+  ///     var queue: Deque = [1, 2, 3, 4, 5]
+  ///     let batch = UnsafeMutableBufferPointer<Int>.allocate(capacity: 3)
+  ///     queue.removeFirst(3, into: batch)
+  ///     // batch holds 1, 2, 3; queue is [4, 5]
+  ///
+  /// - Parameters:
+  ///   - n: The number of elements to remove. `n` must be greater than or
+  ///      equal to zero, and must not exceed the number of elements in the
+  ///      deque.
+  ///   - target: A buffer with room for at least `n` elements. Its first `n`
+  ///      items must be uninitialized.
+  ///
+  /// - Complexity: O(`n`) if this instance has a unique reference to its
+  ///    underlying storage; O(`count`) otherwise.
+  @inlinable
+  public mutating func removeFirst(
+    _ n: Int,
+    into target: UnsafeMutableBufferPointer<Element>
+  ) {
+    precondition(n >= 0, "Can't remove a negative number of elements")
+    precondition(n <= count, "Can't remove more items from a deque than it contains")
+    precondition(n <= target.count, "Target buffer is too small")
+    guard n > 0 else { return }
+    _storage.ensureUnique()
+    _storage.update { handle in
+      let source = handle.mutableSegments(forOffsets: 0 ..< n)
+      let wrap = source.first.count
+      target.baseAddress!.moveInitialize(
+        from: source.first.baseAddress!, count: wrap)
+      if let second = source.second {
+        (target.baseAddress! + wrap).moveInitialize(
+          from: second.baseAddress!, count: second.count)
+      }
+      handle.startSlot = handle.slot(handle.startSlot, offsetBy: n)
+      handle.count -= n
+    }
+    _storage.shrinkIfNeeded()
+  }
+}
@@ -0,0 +1,191 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension Deque {
+  /// Ensure this deque has unique storage with its elements arranged in a
+  /// single contiguous region, then call `body` with a buffer covering them.
+  ///
+  /// Unlike `withContiguousMutableStorageIfAvailable`, this always succeeds:
+  /// if the contents are wrapped around the end of the storage buffer, they
+  /// are rotated into place first. The rotation happens in place, without
+  /// allocating a new buffer.
+  @inlinable
+  internal mutating func _withContiguousElements<R>(
+    _ body: (UnsafeMutableBufferPointer<Element>) throws -> R
+  ) rethrows -> R {
+    _storage.ensureUnique()
+    return try _storage.update { handle in
+      try body(handle.makeContiguous())
+    }
+  }
+}
+
+extension Deque {
+  /// Sorts the deque in place, using the given predicate as the comparison
+  /// between elements.
+  ///
+  /// The deque's contents are first rearranged into a single contiguous
+  /// region of its storage buffer (if they aren't already), then sorted
+  /// directly in that buffer, without any index translation.
+  ///
+  /// The sorting algorithm is not guaranteed to be stable. A stable sort
+  /// preserves the relative order of elements for which
+  /// `areInIncreasingOrder` does not establish an order.
+  ///
+  /// - Parameter areInIncreasingOrder: A predicate that returns `true` if its
+  ///    first argument should be ordered before its second argument;
+  ///    otherwise, `false`. It must be a strict weak ordering over the
+  ///    elements.
+  ///
+  /// - Complexity: O(*n* log *n*), where *n* is the length of the deque.
+  @inlinable
+  public mutating func sort(
+    by areInIncreasingOrder: (Element, Element) throws -> Bool
+  ) rethrows {
+    guard count > 1 else { return }
+    try _withContiguousElements { buffer in
+      var buffer = buffer
+      try buffer.sort(by: areInIncreasingOrder)
+    }
+  }
+
+  /// Reorders the elements of the deque such that the element at the
+  /// specified position is the one that would be there if the deque was
+  /// sorted, all elements before it are not ordered after it, and all
+  /// elements after it are not ordered before it.
+  ///
+  /// This is the equivalent of C++'s `std::nth_element`. It is useful for
+  /// finding medians, percentiles, or the smallest `n` elements of a deque
+  /// without paying for a full sort. The order of the elements within each of
+  /// the two partitions is unspecified.
+  ///
+  ///     var samples: Deque = [7, 1, 9, 4, 3, 8, 2]
+  ///     let median = samples.partition(aroundNthElement: 3, by: <)
+  ///     // median == 4
+  ///     // samples[..<3] contains 1, 2 and 3 in some order.
+  ///
+  /// - Parameters:
+  ///   - n: The position of the element to select. `n` must be a valid index
+  ///      of the deque (not equal to `endIndex`).
+  ///   - areInIncreasingOrder: A predicate that returns `true` if its first
+  ///      argument should be ordered before its second argument; otherwise,
+  ///      `false`. It must be a strict weak ordering over the elements.
+  ///
+  /// - Returns: The element that ended up at position `n`.
+  ///
+  /// - Complexity: O(*n*) on average, where *n* is the length of the deque;
+  ///    O(*n* log *n*) in the worst case.
+  @inlinable
+  @discardableResult
+  public mutating func partition(
+    aroundNthElement n: Int,
+    by areInIncreasingOrder: (Element, Element) throws -> Bool
+  ) rethrows -> Element {
+    precondition(n >= 0 && n < count, "Index out of bounds")
+    return try _withContiguousElements { buffer in
+      try Self._select(n, in: buffer, by: areInIncreasingOrder)
+      return buffer[n]
+    }
+  }
+}
+
+extension Deque where Element: Comparable {
+  /// Sorts the deque in place.
+  ///
+  /// The deque's contents are first rearranged into a single contiguous
+  /// region of its storage buffer (if they aren't already), then sorted
+  /// directly in that buffer, without any index translation.
+  ///
+  /// - Complexity: O(*n* log *n*), where *n* is the length of the deque.
+  @inlinable
+  public mutating func sort() {
+    sort(by: <)
+  }
+
+  /// Reorders the elements of the deque such that the element at the
+  /// specified position is the one that would be there if the deque was
+  /// sorted in ascending order, all elements before it are less than or equal
+  /// to it, and all elements after it are greater than or equal to it.
+  ///
+  /// - Parameter n: The position of the element to select. `n` must be a valid
+  ///    index of the deque (not equal to `endIndex`).
+  ///
+  /// - Returns: The element that ended up at position `n`.
+  ///
+  /// - Complexity: O(*n*) on average, where *n* is the length of the deque;
+  ///    O(*n* log *n*) in the worst case.
+  @inlinable
+  @discardableResult
+  public mutating func partition(aroundNthElement n: Int) -> Element {
+    partition(aroundNthElement: n, by: <)
+  }
+}
+
+extension Deque {
+  /// Order the elements at positions `a`, `b` and `c` in `buffer`.
+  @inlinable
+  internal static func _sort3(
+    _ buffer: UnsafeMutableBufferPointer<Element>,
+    _ a: Int, _ b: Int, _ c: Int,
+    by areInIncreasingOrder: (Element, Element) throws -> Bool
+  ) rethrows {
+    if try areInIncreasingOrder(buffer[b], buffer[a]) {
+      buffer.swapAt(a, b)
+    }
+    if try areInIncreasingOrder(buffer[c], buffer[b]) {
+      buffer.swapAt(b, c)
+      if try areInIncreasingOrder(buffer[b], buffer[a]) {
+        buffer.swapAt(a, b)
+      }
+    }
+  }
+
+  /// Introselect: quickselect with median-of-three pivots, falling back to
+  /// sorting the remaining range when partitioning fails to make progress
+  /// quickly enough.
+  @inlinable
+  internal static func _select(
+    _ n: Int,
+    in buffer: UnsafeMutableBufferPointer<Element>,
+    by areInIncreasingOrder: (Element, Element) throws -> Bool
+  ) rethrows {
+    var lower = 0
+    var upper = buffer.count
+    var budget = 2 * (Int.bitWidth - buffer.count.leadingZeroBitCount)
+    while upper - lower > 16 && budget > 0 {
+      budget -= 1
+      let middle = lower + (upper - lower) / 2
+      try _sort3(buffer, lower, middle, upper - 1, by: areInIncreasingOrder)
+      // Use the median as the pivot, keeping it at `lower` during
+      // partitioning. The maximum stays at `upper - 1`, acting as a sentinel.
+      buffer.swapAt(lower, middle)
+      var i = lower + 1
+      var j = upper - 1
+      while true {
+        while try areInIncreasingOrder(buffer[i], buffer[lower]) { i += 1 }
+        while try areInIncreasingOrder(buffer[lower], buffer[j]) { j -= 1 }
+        if i >= j { break }
+        buffer.swapAt(i, j)
+        i += 1
+        j -= 1
+      }
+      buffer.swapAt(lower, j)
+      if n == j { return }
+      if n < j {
+        upper = j
+      } else {
+        lower = j + 1
+      }
+    }
+    var rest = UnsafeMutableBufferPointer(rebasing: buffer[lower ..< upper])
+    try rest.sort(by: areInIncreasingOrder)
+  }
+}
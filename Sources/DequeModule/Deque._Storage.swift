@@ -46,7 +46,10 @@ extension Deque._Storage {
   }
 
   @inlinable
-  internal init(minimumCapacity: Int) {
+  internal init(
+    minimumCapacity: Int,
+    policy: DequeStoragePolicy = .default
+  ) {
     let object = _DequeBuffer<Element>.create(
       minimumCapacity: minimumCapacity,
       makingHeaderWith: {
@@ -55,7 +58,27 @@ extension Deque._Storage {
         #else
         let capacity = $0.capacity
         #endif
-        return _DequeBufferHeader(capacity: capacity, count: 0, startSlot: .zero)
+        return _DequeBufferHeader(
+          capacity: capacity, count: 0, startSlot: .zero, policy: policy)
+      })
+    self.init(_buffer: _Buffer(unsafeBufferObject: object))
+  }
+
+  /// Create a new storage instance whose logical capacity is exactly
+  /// `capacity`, even if the allocator happened to give us more room. This is
+  /// used by fixed-capacity ring buffers, where the capacity is part of the
+  /// value's observable state.
+  @inlinable
+  internal init(exactCapacity capacity: Int) {
+    assert(capacity >= 0)
+    guard capacity > 0 else {
+      self.init()
+      return
+    }
+    let object = _DequeBuffer<Element>.create(
+      minimumCapacity: capacity,
+      makingHeaderWith: { _ in
+        _DequeBufferHeader(capacity: capacity, count: 0, startSlot: .zero)
       })
     self.init(_buffer: _Buffer(unsafeBufferObject: object))
   }
@@ -97,6 +120,12 @@ extension Deque._Storage {
     _buffer.withUnsafeMutablePointerToHeader { $0.pointee.startSlot
     }
   }
+
+  @inlinable
+  @inline(__always)
+  internal var policy: DequeStoragePolicy {
+    _buffer.withUnsafeMutablePointerToHeader { $0.pointee.policy }
+  }
 }
 
 extension Deque._Storage {
@@ -155,10 +184,12 @@ extension Deque._Storage {
   }
 
   /// The growth factor to use to increase storage size to make place for an
-  /// insertion.
+  /// insertion, as configured by the storage policy.
   @inlinable
   @inline(__always)
-  internal static var growthFactor: Double { 1.5 }
+  internal var growthFactor: Double {
+    policy.growthFactor
+  }
 
   @usableFromInline
   internal func _growCapacity(
@@ -166,7 +197,7 @@ extension Deque._Storage {
     linearly: Bool
   ) -> Int {
     if linearly { return Swift.max(capacity, minimumCapacity) }
-    return Swift.max(Int((Self.growthFactor * Double(capacity)).rounded(.up)),
+    return Swift.max(Int((growthFactor * Double(capacity)).rounded(.up)),
                      minimumCapacity)
   }
 
@@ -224,3 +255,56 @@ extension Deque._Storage {
     self._buffer.buffer === other._buffer.buffer
   }
 }
+
+extension Deque._Storage {
+  /// Reallocate storage into a smaller buffer if the storage policy calls for
+  /// it. This must be called after every operation that removes elements from
+  /// a uniquely referenced buffer.
+  @inlinable
+  @inline(__always)
+  internal mutating func shrinkIfNeeded() {
+    let shouldShrink = _buffer.withUnsafeMutablePointerToHeader {
+      $0.pointee.shouldShrink
+    }
+    if _slowPath(shouldShrink) {
+      _shrinkForPolicy()
+    }
+  }
+
+  @inlinable
+  @inline(never)
+  internal mutating func _shrinkForPolicy() {
+    let policy = self.policy
+    let target = Swift.max(
+      Int((policy.growthFactor * Double(count)).rounded(.up)),
+      policy.minimumCapacity)
+    shrink(toCapacity: target)
+  }
+
+  /// Move the contents of this storage instance into a new buffer whose
+  /// capacity is exactly `newCapacity`. Elements are moved in a single pass,
+  /// with the first element ending up at the start of the new buffer. Does
+  /// nothing if the current capacity is already no larger than `newCapacity`.
+  ///
+  /// The new capacity deliberately ignores any extra room the allocator
+  /// provides: otherwise a buffer at the policy's minimum capacity could
+  /// keep getting reallocated to the same size on every removal.
+  @inlinable
+  internal mutating func shrink(toCapacity newCapacity: Int) {
+    assert(newCapacity >= count)
+    guard newCapacity < capacity else { return }
+    if newCapacity == 0 && policy == .default {
+      self = Self()
+      return
+    }
+    if isUnique() {
+      self = self.update { source in
+        source.moveElements(minimumCapacity: newCapacity, exactCapacity: true)
+      }
+    } else {
+      self = self.read { source in
+        source.copyElements(minimumCapacity: newCapacity, exactCapacity: true)
+      }
+    }
+  }
+}
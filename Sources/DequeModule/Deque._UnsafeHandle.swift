@@ -224,6 +224,56 @@ extension Deque._UnsafeHandle {
   }
 }
 
+extension Deque._UnsafeHandle {
+  /// Rearrange storage in place so that the contents of the deque occupy a
+  /// single contiguous region, and return a buffer pointer covering it.
+  ///
+  /// If the contents are wrapped, then elements are moved at most twice; if
+  /// there is enough free capacity to hold either segment, each element is
+  /// moved only once. This does not allocate any memory.
+  ///
+  /// This function does not ensure that the storage buffer is uniquely
+  /// referenced.
+  @inlinable
+  @discardableResult
+  internal func makeContiguous() -> UnsafeMutableBufferPointer<Element> {
+    assertMutable()
+    let segments = mutableSegments()
+    guard let second = segments.second else { return segments.first }
+    let first = segments.first
+    let gap = capacity - count
+    let start: Int
+    if second.count <= gap {
+      // [B, gap, A] => [gap, A, B]: slide A down to make room for B at the end.
+      start = startSlot.position - second.count
+      (_elements + start).moveInitialize(
+        from: first.baseAddress!, count: first.count)
+      (_elements + start + first.count).moveInitialize(
+        from: second.baseAddress!, count: second.count)
+    } else if first.count <= gap {
+      // [B, gap, A] => [A, B, gap]: slide B up to make room for A at the start.
+      start = 0
+      (_elements + first.count).moveInitialize(
+        from: second.baseAddress!, count: second.count)
+      _elements.moveInitialize(from: first.baseAddress!, count: first.count)
+    } else {
+      // [B, gap, A] => [gap, B, A] => [gap, A, B]: close the gap, then rotate
+      // the initialized region by reversing it in pieces.
+      start = gap
+      (_elements + gap).moveInitialize(
+        from: second.baseAddress!, count: second.count)
+      var all = UnsafeMutableBufferPointer(start: _elements + gap, count: count)
+      all.reverse()
+      var head = UnsafeMutableBufferPointer(rebasing: all[..<first.count])
+      head.reverse()
+      var tail = UnsafeMutableBufferPointer(rebasing: all[first.count...])
+      tail.reverse()
+    }
+    startSlot = Slot(at: start)
+    return UnsafeMutableBufferPointer(start: _elements + start, count: count)
+  }
+}
+
 
 
 extension Deque._UnsafeHandle {
@@ -292,9 +342,13 @@ extension Deque._UnsafeHandle {
   }
 
   /// Copy elements into a new storage instance with the specified minimum
-  /// capacity.
+  /// capacity. If `exactCapacity` is true, then the new storage ignores any
+  /// extra space the allocator happens to provide.
   @inlinable
-  internal func copyElements(minimumCapacity: Int) -> Deque._Storage {
+  internal func copyElements(
+    minimumCapacity: Int,
+    exactCapacity: Bool = false
+  ) -> Deque._Storage {
     assert(minimumCapacity >= count)
     let object = _DequeBuffer<Element>.create(
       minimumCapacity: minimumCapacity,
@@ -302,12 +356,13 @@ extension Deque._UnsafeHandle {
         #if os(OpenBSD)
         let capacity = minimumCapacity
         #else
-        let capacity = $0.capacity
+        let capacity = exactCapacity ? minimumCapacity : $0.capacity
         #endif
         return _DequeBufferHeader(
           capacity: capacity,
           count: count,
-          startSlot: .zero)
+          startSlot: .zero,
+          policy: header.policy)
       })
     let result = Deque._Storage(_buffer: ManagedBufferPointer(unsafeBufferObject: object))
     guard count > 0 else { return result }
@@ -324,9 +379,13 @@ extension Deque._UnsafeHandle {
 
   /// Move elements into a new storage instance with the specified minimum
   /// capacity. Existing indices in `self` won't necessarily be valid in the
-  /// result. `self` is left empty.
+  /// result. `self` is left empty. If `exactCapacity` is true, then the new
+  /// storage ignores any extra space the allocator happens to provide.
   @inlinable
-  internal func moveElements(minimumCapacity: Int) -> Deque._Storage {
+  internal func moveElements(
+    minimumCapacity: Int,
+    exactCapacity: Bool = false
+  ) -> Deque._Storage {
     assertMutable()
     let count = self.count
     assert(minimumCapacity >= count)
@@ -336,12 +395,13 @@ extension Deque._UnsafeHandle {
         #if os(OpenBSD)
         let capacity = minimumCapacity
         #else
-        let capacity = $0.capacity
+        let capacity = exactCapacity ? minimumCapacity : $0.capacity
         #endif
         return _DequeBufferHeader(
           capacity: capacity,
           count: count,
-          startSlot: .zero)
+          startSlot: .zero,
+          policy: header.policy)
       })
     let result = Deque._Storage(_buffer: ManagedBufferPointer(unsafeBufferObject: object))
     guard count > 0 else { return result }
@@ -431,6 +491,23 @@ extension Deque._UnsafeHandle {
     let gap = mutableSegments(forOffsets: c ..< count)
     gap.initialize(from: source)
   }
+
+  /// Append `element` to this buffer, which must be full, by overwriting its
+  /// first element. Returns the element that got evicted.
+  ///
+  /// This function does not validate its input arguments in release builds. Nor
+  /// does it ensure that the storage buffer is uniquely referenced.
+  @inlinable
+  internal func uncheckedAppendEvictingFirst(_ element: Element) -> Element {
+    assertMutable()
+    assert(capacity > 0 && count == capacity)
+    // In a full buffer, the end slot coincides with the start slot.
+    let slot = startSlot
+    let result = ptr(at: slot).move()
+    ptr(at: slot).initialize(to: element)
+    startSlot = self.slot(after: slot)
+    return result
+  }
 }
 
 // MARK: Prepending
@@ -464,6 +541,23 @@ extension Deque._UnsafeHandle {
     let gap = mutableWrappedBuffer(between: newStart, and: oldStart)
     gap.initialize(from: source)
   }
+
+  /// Prepend `element` to this buffer, which must be full, by overwriting its
+  /// last element. Returns the element that got evicted.
+  ///
+  /// This function does not validate its input arguments in release builds. Nor
+  /// does it ensure that the storage buffer is uniquely referenced.
+  @inlinable
+  internal func uncheckedPrependEvictingLast(_ element: Element) -> Element {
+    assertMutable()
+    assert(capacity > 0 && count == capacity)
+    // In a full buffer, the slot preceding the start holds the last element.
+    let slot = self.slot(before: startSlot)
+    let result = ptr(at: slot).move()
+    ptr(at: slot).initialize(to: element)
+    startSlot = slot
+    return result
+  }
 }
 
 // MARK: Insertion
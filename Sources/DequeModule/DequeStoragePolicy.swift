@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// Controls how a `Deque` resizes its storage buffer as elements are inserted
+/// and removed.
+///
+/// By default, deques grow their storage geometrically and never give memory
+/// back until they're deallocated. This is the right tradeoff for most
+/// short-lived collections, but long-lived queues that occasionally see large
+/// spikes in their element count can end up holding on to far more memory
+/// than they need. Configure a shrink threshold to have the deque reclaim
+/// unused capacity automatically as elements are removed:
+///
+///     var queue: Deque<Request> = []
+///     queue.storagePolicy = DequeStoragePolicy(
+///       shrinkThreshold: 0.25,
+///       minimumCapacity: 1024)
+///
+/// When a removal leaves the deque filled to less than `shrinkThreshold` of
+/// its capacity, the deque moves its elements into a smaller buffer with
+/// room for `growthFactor` times its current count. Because the new buffer
+/// isn't full, the deque needs to go through a proportional number of
+/// insertions or removals before it has to resize again, so the amortized
+/// cost of every operation stays O(1).
+@frozen
+public struct DequeStoragePolicy: Hashable, Sendable {
+  /// The factor by which the deque multiplies its capacity when it needs to
+  /// grow its storage. This is always greater than 1.
+  public let growthFactor: Double
+
+  /// The fraction of capacity below which removing elements causes the deque
+  /// to shrink its storage, or zero if the deque never shrinks
+  /// automatically.
+  public let shrinkThreshold: Double
+
+  /// The capacity below which the deque never automatically shrinks its
+  /// storage.
+  public let minimumCapacity: Int
+
+  /// Creates a new storage policy.
+  ///
+  /// - Parameters:
+  ///   - growthFactor: The factor by which to multiply the capacity of the
+  ///      deque when it runs out of room. It must be greater than 1. The
+  ///      default value is 1.5.
+  ///   - shrinkThreshold: The minimum fraction of the deque's capacity that
+  ///      needs to be in use after a removal for the deque to keep its
+  ///      storage buffer. Pass zero to never shrink automatically. For the
+  ///      policy to avoid repeatedly resizing the same deque, the threshold
+  ///      must be less than `1 / growthFactor`. The default value is zero.
+  ///   - minimumCapacity: Automatic shrinking never reduces the capacity of
+  ///      the deque below this value. The default value is zero.
+  @inlinable
+  public init(
+    growthFactor: Double = 1.5,
+    shrinkThreshold: Double = 0,
+    minimumCapacity: Int = 0
+  ) {
+    precondition(growthFactor > 1 && growthFactor.isFinite,
+                 "Growth factor must be a finite value greater than one")
+    precondition(shrinkThreshold >= 0 && shrinkThreshold * growthFactor < 1,
+                 "Shrink threshold must be in 0 ..< 1 / growthFactor")
+    precondition(minimumCapacity >= 0, "Minimum capacity must be nonnegative")
+    self.growthFactor = growthFactor
+    self.shrinkThreshold = shrinkThreshold
+    self.minimumCapacity = minimumCapacity
+  }
+
+  /// The default storage policy, which grows capacity by a factor of 1.5 and
+  /// never shrinks it automatically.
+  @inlinable
+  public static var `default`: Self { Self() }
+}
+
+extension DequeStoragePolicy: CustomStringConvertible {
+  /// A textual representation of this instance.
+  public var description: String {
+    """
+    DequeStoragePolicy(growthFactor: \(growthFactor), \
+    shrinkThreshold: \(shrinkThreshold), \
+    minimumCapacity: \(minimumCapacity))
+    """
+  }
+}
+
+extension Deque {
+  /// The policy that controls how this deque grows and shrinks its storage
+  /// buffer.
+  ///
+  /// The storage policy is an attribute of the deque's storage, not part of
+  /// its value: it doesn't participate in equality comparisons or hashing,
+  /// and copies of a deque that share the same storage also share its
+  /// policy. Deques created from scratch, including by assigning a new
+  /// value, use the default policy. Removing elements, including via
+  /// `removeAll(keepingCapacity:)`, keeps the current policy.
+  ///
+  /// Setting a policy with a shrink threshold immediately shrinks the
+  /// deque's storage if its current occupancy is below the new threshold.
+  ///
+  /// - Complexity: Reading this property is O(1). Setting it is O(`count`)
+  ///    if the storage isn't uniquely referenced or needs to shrink;
+  ///    otherwise it is O(1).
+  @inlinable
+  public var storagePolicy: DequeStoragePolicy {
+    get {
+      _storage.policy
+    }
+    set {
+      _storage.ensureUnique()
+      _storage.update { $0._header.pointee.policy = newValue }
+      _storage.shrinkIfNeeded()
+    }
+  }
+
+  /// Reduces the capacity of the deque to fit its current contents,
+  /// releasing any unused storage.
+  ///
+  /// The deque's elements are moved into a newly allocated buffer that is
+  /// just large enough to hold them, in a single pass. If the contents
+  /// wrapped around the end of the old buffer, they are contiguous in the
+  /// new one. Unlike the automatic shrinking enabled by `storagePolicy`,
+  /// this method ignores the policy's minimum capacity.
+  ///
+  /// - Complexity: O(`count`)
+  @inlinable
+  public mutating func shrinkToFit() {
+    _storage.shrink(toCapacity: count)
+  }
+}
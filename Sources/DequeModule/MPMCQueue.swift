@@ -0,0 +1,402 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import Synchronization
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+/// A bounded, lock-free queue that can be shared between any number of
+/// producer and consumer threads.
+///
+/// `MPMCQueue` implements Dmitry Vyukov's bounded multi-producer,
+/// multi-consumer queue algorithm. Elements are stored in a circular buffer
+/// with the same layout as `Deque`'s storage, with a capacity that is rounded
+/// up to a power of two. Each slot in the buffer is paired with a sequence
+/// number that records which lap of the buffer the slot is ready for, and
+/// whether it is currently waiting for a producer or a consumer:
+///
+/// - A producer claims the next free position by advancing the shared tail
+///   counter with a compare-and-exchange operation, initializes the element,
+///   then publishes it by bumping the slot's sequence number.
+/// - A consumer does the same with the shared head counter, moves the element
+///   out of its slot, then marks the slot as free for the next lap.
+///
+/// Threads contend only on the two counters (which are kept on separate cache
+/// lines); element transfers through different slots proceed in parallel.
+///
+///     let queue = MPMCQueue<Int>(minimumCapacity: 1024)
+///     // On any number of producer threads:
+///     queue.push(42)
+///     // On any number of consumer threads:
+///     let value = queue.pop()
+///
+/// Bulk operations (`tryPush(contentsOf:)` and `tryPop(maximumCount:into:)`)
+/// claim a whole run of consecutive slots with a single compare-and-exchange,
+/// amortizing the cost of contention over many elements.
+///
+/// The queue does not guarantee any ordering between elements pushed by
+/// different threads, but elements pushed by the same thread are popped in the
+/// order they were pushed.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+public final class MPMCQueue<Element> {
+  @usableFromInline
+  internal typealias _Slot = _DequeSlot
+
+  /// The circular buffer holding the queued elements. Its header only records
+  /// the buffer's capacity while the queue is alive; the live range of
+  /// elements is tracked by `_head` and `_tail`.
+  @usableFromInline
+  internal let _storage: Deque<Element>._Storage
+
+  /// The sequence numbers of each slot in `_storage`.
+  ///
+  /// When the slot at position `p & _mask` holds the value `p`, it is free
+  /// and ready to receive the element pushed at position `p`. When it holds
+  /// `p + 1`, it contains the element pushed at position `p`, ready to be
+  /// popped.
+  @usableFromInline
+  internal let _sequences: UnsafeMutablePointer<Atomic<Int>>
+
+  /// The capacity of `_storage` minus one. (The capacity is a power of two.)
+  @usableFromInline
+  internal let _mask: Int
+
+  @usableFromInline
+  internal let _padding0 = _CacheLinePadding()
+
+  /// The position of the next element to pop.
+  @usableFromInline
+  internal let _head: Atomic<Int>
+
+  @usableFromInline
+  internal let _padding1 = _CacheLinePadding()
+
+  /// The position of the next element to push.
+  @usableFromInline
+  internal let _tail: Atomic<Int>
+
+  @usableFromInline
+  internal let _padding2 = _CacheLinePadding()
+
+  /// Creates an empty queue that can hold at least the specified number of
+  /// elements.
+  ///
+  /// - Parameter minimumCapacity: The minimum number of elements the queue
+  ///    should be able to hold. The actual capacity is rounded up to the next
+  ///    power of two, and it is always at least two.
+  public init(minimumCapacity: Int) {
+    precondition(minimumCapacity >= 0, "Capacity must not be negative")
+    // The sequence numbering scheme cannot distinguish a full slot from a free
+    // one in a buffer of a single element.
+    let capacity = Swift.max(2, minimumCapacity)._roundUpToPowerOfTwo()
+    self._storage = Deque<Element>._Storage(exactCapacity: capacity)
+    self._sequences = .allocate(capacity: capacity)
+    for i in 0 ..< capacity {
+      (_sequences + i).initialize(to: Atomic(i))
+    }
+    self._mask = capacity &- 1
+    self._head = Atomic(0)
+    self._tail = Atomic(0)
+  }
+
+  deinit {
+    let head = _head.load(ordering: .acquiring)
+    let tail = _tail.load(ordering: .acquiring)
+    // Describe the remaining elements in the storage header, so that the
+    // buffer deinitializes them when it is released.
+    _storage.update { handle in
+      handle.startSlot = _Slot(at: head & _mask)
+      handle.count = tail &- head
+    }
+    _sequences.deinitialize(count: _mask &+ 1)
+    _sequences.deallocate()
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension MPMCQueue: @unchecked Sendable where Element: Sendable {}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension MPMCQueue {
+  /// The maximum number of elements the queue can hold at once.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var capacity: Int {
+    _mask &+ 1
+  }
+
+  /// The number of elements currently in the queue.
+  ///
+  /// If the queue is being accessed concurrently, the returned value is only
+  /// a snapshot that may be out of date by the time it is returned. It
+  /// includes elements that are in the process of being pushed or popped.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var count: Int {
+    let head = _head.load(ordering: .acquiring)
+    let tail = _tail.load(ordering: .acquiring)
+    return Swift.min(Swift.max(0, tail &- head), capacity)
+  }
+
+  /// A Boolean value indicating whether the queue is currently empty.
+  ///
+  /// If the queue is being accessed concurrently, the returned value is only
+  /// a snapshot that may be out of date by the time it is returned.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var isEmpty: Bool {
+    count == 0
+  }
+
+  @inlinable
+  @inline(__always)
+  internal func _sequence(at position: Int) -> Int {
+    _sequences[position & _mask].load(ordering: .acquiring)
+  }
+
+  @inlinable
+  @inline(__always)
+  internal func _setSequence(at position: Int, to value: Int) {
+    _sequences[position & _mask].store(value, ordering: .releasing)
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension MPMCQueue {
+  /// Claims up to `maximumCount` consecutive positions for pushing, and
+  /// returns the first claimed position and the number of positions claimed.
+  /// The count is zero if the queue is full.
+  @inlinable
+  internal func _claimForPush(maximumCount: Int) -> (position: Int, count: Int) {
+    assert(maximumCount > 0)
+    var position = _tail.load(ordering: .relaxed)
+    while true {
+      // Count the slots that are ready for this lap. A ready slot stays ready
+      // until someone claims its position, so the run cannot shrink unless
+      // the compare-and-exchange below fails.
+      var n = 0
+      while n < maximumCount && n <= _mask {
+        let diff = _sequence(at: position &+ n) &- (position &+ n)
+        if diff != 0 {
+          if n == 0 && diff > 0 {
+            // Another producer got here first; we have a stale position.
+            n = -1
+          }
+          break
+        }
+        n &+= 1
+      }
+      if n == 0 { return (position, 0) }
+      if n > 0 {
+        let (exchanged, original) = _tail.compareExchange(
+          expected: position,
+          desired: position &+ n,
+          ordering: .relaxed)
+        if exchanged { return (position, n) }
+        position = original
+      } else {
+        position = _tail.load(ordering: .relaxed)
+      }
+    }
+  }
+
+  /// Claims up to `maximumCount` consecutive positions for popping, and
+  /// returns the first claimed position and the number of positions claimed.
+  /// The count is zero if the queue is empty.
+  @inlinable
+  internal func _claimForPop(maximumCount: Int) -> (position: Int, count: Int) {
+    assert(maximumCount > 0)
+    var position = _head.load(ordering: .relaxed)
+    while true {
+      var n = 0
+      while n < maximumCount && n <= _mask {
+        let diff = _sequence(at: position &+ n) &- (position &+ n &+ 1)
+        if diff != 0 {
+          if n == 0 && diff > 0 {
+            // Another consumer got here first; we have a stale position.
+            n = -1
+          }
+          break
+        }
+        n &+= 1
+      }
+      if n == 0 { return (position, 0) }
+      if n > 0 {
+        let (exchanged, original) = _head.compareExchange(
+          expected: position,
+          desired: position &+ n,
+          ordering: .relaxed)
+        if exchanged { return (position, n) }
+        position = original
+      } else {
+        position = _head.load(ordering: .relaxed)
+      }
+    }
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension MPMCQueue {
+  /// Adds an element to the end of the queue, unless the queue is full.
+  ///
+  /// - Parameter element: The element to push.
+  ///
+  /// - Returns: True if the element was pushed; false if the queue was full.
+  ///
+  /// - Complexity: O(1) if there is no contention.
+  @inlinable
+  public func tryPush(_ element: __owned Element) -> Bool {
+    let (position, n) = _claimForPush(maximumCount: 1)
+    guard n == 1 else { return false }
+    _storage.update { handle in
+      handle.ptr(at: _Slot(at: position & _mask)).initialize(to: element)
+    }
+    _setSequence(at: position, to: position &+ 1)
+    return true
+  }
+
+  /// Adds as many elements from the start of the given collection to the end
+  /// of the queue as there is room for.
+  ///
+  /// The pushed elements occupy consecutive positions in the queue, even if
+  /// other threads are pushing at the same time.
+  ///
+  /// - Parameter elements: The elements to push.
+  ///
+  /// - Returns: The number of elements pushed. This is the length of the
+  ///    prefix of `elements` that got added to the queue; it is zero if the
+  ///    queue was full.
+  ///
+  /// - Complexity: O(*n*) if there is no contention, where *n* is the number
+  ///    of elements pushed.
+  @inlinable
+  public func tryPush<C: Collection>(
+    contentsOf elements: C
+  ) -> Int where C.Element == Element {
+    let requested = elements.count
+    guard requested > 0 else { return 0 }
+    let (position, n) = _claimForPush(maximumCount: requested)
+    guard n > 0 else { return 0 }
+    _storage.update { handle in
+      let gap = handle.mutableWrappedBuffer(
+        between: _Slot(at: position & _mask),
+        and: _Slot(at: (position &+ n) & _mask))
+      assert(gap.count == n)
+      gap.initialize(from: elements.prefix(n))
+    }
+    for p in position ..< position &+ n {
+      _setSequence(at: p, to: p &+ 1)
+    }
+    return n
+  }
+
+  /// Adds an element to the end of the queue, waiting for room to become
+  /// available if the queue is full.
+  ///
+  /// While the queue is full, the calling thread repeatedly retries,
+  /// periodically yielding its processor to other threads.
+  ///
+  /// - Parameter element: The element to push.
+  @inlinable
+  public func push(_ element: __owned Element) {
+    var backoff = _Backoff()
+    while !tryPush(element) {
+      backoff.wait()
+    }
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension MPMCQueue {
+  /// Removes and returns the element at the front of the queue, if any.
+  ///
+  /// - Returns: The oldest available element in the queue, or `nil` if the
+  ///    queue was empty.
+  ///
+  /// - Complexity: O(1) if there is no contention.
+  @inlinable
+  public func tryPop() -> Element? {
+    let (position, n) = _claimForPop(maximumCount: 1)
+    guard n == 1 else { return nil }
+    let element = _storage.update { handle in
+      handle.ptr(at: _Slot(at: position & _mask)).move()
+    }
+    _setSequence(at: position, to: position &+ _mask &+ 1)
+    return element
+  }
+
+  /// Removes up to `maximumCount` elements from the front of the queue,
+  /// appending them to `target` in order.
+  ///
+  /// The removed elements occupy consecutive positions in the queue, even if
+  /// other threads are popping at the same time.
+  ///
+  /// - Parameters:
+  ///   - maximumCount: The maximum number of elements to remove. This must
+  ///      not be negative.
+  ///   - target: The collection to append the removed elements to.
+  ///
+  /// - Returns: The number of elements removed, which is zero if the queue
+  ///    was empty.
+  ///
+  /// - Complexity: O(*n*) if there is no contention, where *n* is the number
+  ///    of elements removed.
+  @inlinable
+  public func tryPop<C: RangeReplaceableCollection>(
+    maximumCount: Int,
+    into target: inout C
+  ) -> Int where C.Element == Element {
+    precondition(maximumCount >= 0, "Count must not be negative")
+    guard maximumCount > 0 else { return 0 }
+    let (position, n) = _claimForPop(maximumCount: maximumCount)
+    guard n > 0 else { return 0 }
+    _storage.update { handle in
+      let segments = handle.mutableWrappedBuffer(
+        between: _Slot(at: position & _mask),
+        and: _Slot(at: (position &+ n) & _mask))
+      assert(segments.count == n)
+      target.append(contentsOf: segments.first)
+      if let second = segments.second {
+        target.append(contentsOf: second)
+      }
+      segments.deinitialize()
+    }
+    for p in position ..< position &+ n {
+      _setSequence(at: p, to: p &+ _mask &+ 1)
+    }
+    return n
+  }
+
+  /// Removes and returns the element at the front of the queue, waiting for
+  /// an element to become available if the queue is empty.
+  ///
+  /// While the queue is empty, the calling thread repeatedly retries,
+  /// periodically yielding its processor to other threads.
+  ///
+  /// - Returns: The oldest available element in the queue.
+  @inlinable
+  public func pop() -> Element {
+    var backoff = _Backoff()
+    while true {
+      if let element = tryPop() {
+        return element
+      }
+      backoff.wait()
+    }
+  }
+}
+#endif
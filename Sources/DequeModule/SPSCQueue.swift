@@ -0,0 +1,322 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import Synchronization
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+/// A bounded, lock-free queue for handing off elements from a single producer
+/// thread to a single consumer thread.
+///
+/// `SPSCQueue` stores its elements in a circular buffer with the same layout
+/// as `Deque`'s storage, with a capacity that is rounded up to a power of
+/// two. The producer and the consumer each own one end of the buffer: the
+/// producer only ever advances the tail index, and the consumer only ever
+/// advances the head index. The two indices are kept on separate cache lines,
+/// and each side caches its last observation of the other side's index, so
+/// that in the common case, pushing or popping an element does not touch any
+/// memory that is written by the other thread.
+///
+///     let queue = SPSCQueue<Int>(minimumCapacity: 1024)
+///     // On the producer thread:
+///     queue.push(42)
+///     // On the consumer thread:
+///     let value = queue.pop() // 42
+///
+/// Batched operations (`tryPush(contentsOf:)` and `tryPop(maximumCount:into:)`)
+/// transfer multiple elements at once, copying whole contiguous segments of
+/// the buffer and publishing them with a single atomic store.
+///
+/// - Important: At most one thread may call the producer operations
+///    (`tryPush(_:)`, `tryPush(contentsOf:)`, `push(_:)`) at any given time,
+///    and at most one thread may call the consumer operations (`tryPop()`,
+///    `tryPop(maximumCount:into:)`, `pop()`). Violating this rule results in
+///    undefined behavior.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+public final class SPSCQueue<Element> {
+  @usableFromInline
+  internal typealias _Slot = _DequeSlot
+
+  /// The circular buffer holding the queued elements. Its header only records
+  /// the buffer's capacity while the queue is alive; the live range of
+  /// elements is tracked by `_head` and `_tail`.
+  @usableFromInline
+  internal let _storage: Deque<Element>._Storage
+
+  /// The capacity of `_storage` minus one. (The capacity is a power of two.)
+  @usableFromInline
+  internal let _mask: Int
+
+  @usableFromInline
+  internal let _padding0 = _CacheLinePadding()
+
+  /// The number of elements that have been popped so far. Only the consumer
+  /// updates this.
+  @usableFromInline
+  internal let _head: Atomic<Int>
+
+  /// The consumer's most recent observation of `_tail`.
+  @usableFromInline
+  internal var _consumerTail: Int
+
+  @usableFromInline
+  internal let _padding1 = _CacheLinePadding()
+
+  /// The number of elements that have been pushed so far. Only the producer
+  /// updates this.
+  @usableFromInline
+  internal let _tail: Atomic<Int>
+
+  /// The producer's most recent observation of `_head`.
+  @usableFromInline
+  internal var _producerHead: Int
+
+  @usableFromInline
+  internal let _padding2 = _CacheLinePadding()
+
+  /// Creates an empty queue that can hold at least the specified number of
+  /// elements.
+  ///
+  /// - Parameter minimumCapacity: The minimum number of elements the queue
+  ///    should be able to hold. The actual capacity is rounded up to the next
+  ///    power of two, and it is always at least one.
+  public init(minimumCapacity: Int) {
+    precondition(minimumCapacity >= 0, "Capacity must not be negative")
+    let capacity = Swift.max(1, minimumCapacity)._roundUpToPowerOfTwo()
+    self._storage = Deque<Element>._Storage(exactCapacity: capacity)
+    self._mask = capacity &- 1
+    self._head = Atomic(0)
+    self._consumerTail = 0
+    self._tail = Atomic(0)
+    self._producerHead = 0
+  }
+
+  deinit {
+    let head = _head.load(ordering: .acquiring)
+    let tail = _tail.load(ordering: .acquiring)
+    // Describe the remaining elements in the storage header, so that the
+    // buffer deinitializes them when it is released.
+    _storage.update { handle in
+      handle.startSlot = _Slot(at: head & _mask)
+      handle.count = tail &- head
+    }
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension SPSCQueue: @unchecked Sendable where Element: Sendable {}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension SPSCQueue {
+  /// The maximum number of elements the queue can hold at once.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var capacity: Int {
+    _mask &+ 1
+  }
+
+  /// The number of elements currently in the queue.
+  ///
+  /// If the queue is being accessed concurrently, the returned value is only
+  /// a snapshot that may be out of date by the time it is returned.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var count: Int {
+    let head = _head.load(ordering: .acquiring)
+    let tail = _tail.load(ordering: .acquiring)
+    return Swift.min(tail &- head, capacity)
+  }
+
+  /// A Boolean value indicating whether the queue is currently empty.
+  ///
+  /// If the queue is being accessed concurrently, the returned value is only
+  /// a snapshot that may be out of date by the time it is returned.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var isEmpty: Bool {
+    count == 0
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension SPSCQueue {
+  /// Adds an element to the end of the queue, unless the queue is full.
+  ///
+  /// This is a producer operation.
+  ///
+  /// - Parameter element: The element to push.
+  ///
+  /// - Returns: True if the element was pushed; false if the queue was full.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public func tryPush(_ element: __owned Element) -> Bool {
+    let tail = _tail.load(ordering: .relaxed)
+    if _slowPath(tail &- _producerHead > _mask) {
+      _producerHead = _head.load(ordering: .acquiring)
+      guard tail &- _producerHead <= _mask else { return false }
+    }
+    _storage.update { handle in
+      handle.ptr(at: _Slot(at: tail & _mask)).initialize(to: element)
+    }
+    _tail.store(tail &+ 1, ordering: .releasing)
+    return true
+  }
+
+  /// Adds as many elements from the start of the given collection to the end
+  /// of the queue as there is room for, publishing them all at once.
+  ///
+  /// This is a producer operation.
+  ///
+  /// - Parameter elements: The elements to push.
+  ///
+  /// - Returns: The number of elements pushed. This is the length of the
+  ///    prefix of `elements` that got added to the queue; it is zero if the
+  ///    queue was full.
+  ///
+  /// - Complexity: O(*n*), where *n* is the number of elements pushed.
+  @inlinable
+  public func tryPush<C: Collection>(
+    contentsOf elements: C
+  ) -> Int where C.Element == Element {
+    let requested = elements.count
+    guard requested > 0 else { return 0 }
+    let tail = _tail.load(ordering: .relaxed)
+    var free = capacity &- (tail &- _producerHead)
+    if free < requested {
+      _producerHead = _head.load(ordering: .acquiring)
+      free = capacity &- (tail &- _producerHead)
+    }
+    let n = Swift.min(free, requested)
+    guard n > 0 else { return 0 }
+    _storage.update { handle in
+      let gap = handle.mutableWrappedBuffer(
+        between: _Slot(at: tail & _mask),
+        and: _Slot(at: (tail &+ n) & _mask))
+      assert(gap.count == n)
+      gap.initialize(from: elements.prefix(n))
+    }
+    _tail.store(tail &+ n, ordering: .releasing)
+    return n
+  }
+
+  /// Adds an element to the end of the queue, waiting for room to become
+  /// available if the queue is full.
+  ///
+  /// This is a producer operation. While the queue is full, the calling
+  /// thread repeatedly retries, periodically yielding its processor to other
+  /// threads.
+  ///
+  /// - Parameter element: The element to push.
+  @inlinable
+  public func push(_ element: __owned Element) {
+    var backoff = _Backoff()
+    while !tryPush(element) {
+      backoff.wait()
+    }
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension SPSCQueue {
+  /// Removes and returns the element at the front of the queue, if any.
+  ///
+  /// This is a consumer operation.
+  ///
+  /// - Returns: The oldest element in the queue, or `nil` if the queue was
+  ///    empty.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public func tryPop() -> Element? {
+    let head = _head.load(ordering: .relaxed)
+    if _slowPath(head == _consumerTail) {
+      _consumerTail = _tail.load(ordering: .acquiring)
+      guard head != _consumerTail else { return nil }
+    }
+    let element = _storage.update { handle in
+      handle.ptr(at: _Slot(at: head & _mask)).move()
+    }
+    _head.store(head &+ 1, ordering: .releasing)
+    return element
+  }
+
+  /// Removes up to `maximumCount` elements from the front of the queue,
+  /// appending them to `target` in order.
+  ///
+  /// This is a consumer operation. The elements are transferred in at most
+  /// two contiguous segments, and the room they occupied is released to the
+  /// producer all at once.
+  ///
+  /// - Parameters:
+  ///   - maximumCount: The maximum number of elements to remove. This must
+  ///      not be negative.
+  ///   - target: The collection to append the removed elements to.
+  ///
+  /// - Returns: The number of elements removed, which is zero if the queue
+  ///    was empty.
+  ///
+  /// - Complexity: O(*n*), where *n* is the number of elements removed.
+  @inlinable
+  public func tryPop<C: RangeReplaceableCollection>(
+    maximumCount: Int,
+    into target: inout C
+  ) -> Int where C.Element == Element {
+    precondition(maximumCount >= 0, "Count must not be negative")
+    let head = _head.load(ordering: .relaxed)
+    var available = _consumerTail &- head
+    if available < maximumCount {
+      _consumerTail = _tail.load(ordering: .acquiring)
+      available = _consumerTail &- head
+    }
+    let n = Swift.min(available, maximumCount)
+    guard n > 0 else { return 0 }
+    _storage.update { handle in
+      let segments = handle.mutableWrappedBuffer(
+        between: _Slot(at: head & _mask),
+        and: _Slot(at: (head &+ n) & _mask))
+      assert(segments.count == n)
+      target.append(contentsOf: segments.first)
+      if let second = segments.second {
+        target.append(contentsOf: second)
+      }
+      segments.deinitialize()
+    }
+    _head.store(head &+ n, ordering: .releasing)
+    return n
+  }
+
+  /// Removes and returns the element at the front of the queue, waiting for
+  /// an element to become available if the queue is empty.
+  ///
+  /// This is a consumer operation. While the queue is empty, the calling
+  /// thread repeatedly retries, periodically yielding its processor to other
+  /// threads.
+  ///
+  /// - Returns: The oldest element in the queue.
+  @inlinable
+  public func pop() -> Element {
+    var backoff = _Backoff()
+    while true {
+      if let element = tryPop() {
+        return element
+      }
+      backoff.wait()
+    }
+  }
+}
+#endif
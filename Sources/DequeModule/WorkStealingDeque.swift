@@ -0,0 +1,351 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import Synchronization
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+/// A growable, lock-free work-stealing deque, suitable for implementing
+/// per-worker task queues in a work-stealing scheduler.
+///
+/// `WorkStealingDeque` implements the Chase–Lev algorithm. Each deque has a
+/// single *owner* thread that pushes and pops elements at the bottom end,
+/// like a stack. Any number of other threads (*thieves*) may concurrently
+/// steal elements from the top end, like a queue. The owner's operations
+/// avoid expensive synchronization except when the deque is about to become
+/// empty, so that in the common case, a worker processing its own tasks
+/// doesn't contend with anyone.
+///
+///     let deque = WorkStealingDeque<Task>()
+///     // On the owner thread:
+///     deque.push(task)
+///     let next = deque.pop()
+///     // On any other thread:
+///     let stolen = deque.steal()
+///
+/// Elements are stored in a circular buffer with the same layout as `Deque`'s
+/// storage, with a capacity that is a power of two. When the owner pushes an
+/// element into a full buffer, the deque allocates a larger buffer using
+/// `Deque`'s growth policy, and moves its elements over. Thieves may still be
+/// reading from the previous buffer at this point, so retired buffers are
+/// kept alive until the deque is destroyed. (Due to geometric growth, the
+/// retired buffers together take up less memory than the current one.)
+///
+/// - Important: At most one thread may call the owner operations
+///    (`push(_:)` and `pop()`) at any given time. Violating this rule results
+///    in undefined behavior.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+public final class WorkStealingDeque<Element> {
+  @usableFromInline
+  internal typealias _Slot = _DequeSlot
+
+  @usableFromInline
+  internal typealias _Storage = Deque<Element>._Storage
+
+  /// The buffer currently holding the elements. The header of the buffer
+  /// always has a count of zero; the live range of elements is tracked by
+  /// `_top` and `_bottom`.
+  @usableFromInline
+  internal let _buffer: Atomic<Unmanaged<_DequeBuffer<Element>>>
+
+  /// Every buffer ever allocated by this deque, including the current one.
+  /// Only the owner thread accesses this.
+  @usableFromInline
+  internal var _buffers: [_Storage]
+
+  @usableFromInline
+  internal let _padding0 = _CacheLinePadding()
+
+  /// The position of the topmost element, i.e., the next one to be stolen.
+  @usableFromInline
+  internal let _top: Atomic<Int>
+
+  @usableFromInline
+  internal let _padding1 = _CacheLinePadding()
+
+  /// The position just past the bottommost element, where the owner will
+  /// push the next element.
+  @usableFromInline
+  internal let _bottom: Atomic<Int>
+
+  @usableFromInline
+  internal let _padding2 = _CacheLinePadding()
+
+  /// Creates an empty deque with room for at least the specified number of
+  /// elements before its buffer needs to grow.
+  ///
+  /// - Parameter minimumCapacity: The minimum number of elements the initial
+  ///    buffer should be able to hold. The actual capacity is rounded up to
+  ///    the next power of two.
+  public init(minimumCapacity: Int = 32) {
+    precondition(minimumCapacity >= 0, "Capacity must not be negative")
+    let capacity = Swift.max(1, minimumCapacity)._roundUpToPowerOfTwo()
+    let storage = _Storage(exactCapacity: capacity)
+    self._buffers = [storage]
+    self._buffer = Atomic(Unmanaged.passUnretained(Self._object(of: storage)))
+    self._top = Atomic(0)
+    self._bottom = Atomic(0)
+  }
+
+  deinit {
+    let top = _top.load(ordering: .acquiring)
+    let bottom = _bottom.load(ordering: .acquiring)
+    // Describe the remaining elements in the header of the current buffer,
+    // so that it deinitializes them when it is released. The retired buffers
+    // contain no live elements.
+    _buffers.last!.update { handle in
+      handle.startSlot = _Slot(at: top & (handle.capacity &- 1))
+      handle.count = bottom &- top
+    }
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension WorkStealingDeque: @unchecked Sendable where Element: Sendable {}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension WorkStealingDeque {
+  @inlinable
+  @inline(__always)
+  internal static func _object(of storage: _Storage) -> _DequeBuffer<Element> {
+    unsafeDowncast(storage._buffer.buffer, to: _DequeBuffer<Element>.self)
+  }
+
+  /// Calls the given closure with the header and elements of the current
+  /// buffer.
+  ///
+  /// The buffer is accessed without retaining it, as `_buffers` keeps every
+  /// buffer alive until the deque is destroyed. This spares each operation
+  /// an atomic retain and release on the buffer object, which all threads
+  /// accessing the deque would otherwise contend on.
+  @inlinable
+  @inline(__always)
+  internal func _withCurrentBuffer<R>(
+    ordering: AtomicLoadOrdering,
+    _ body: (
+      UnsafeMutablePointer<_DequeBufferHeader>,
+      UnsafeMutablePointer<Element>
+    ) -> R
+  ) -> R {
+    _buffer.load(ordering: ordering)._withUnsafeGuaranteedRef {
+      $0.withUnsafeMutablePointers(body)
+    }
+  }
+
+  /// Returns the capacity of the current buffer.
+  @inlinable
+  @inline(__always)
+  internal func _currentCapacity(ordering: AtomicLoadOrdering) -> Int {
+    _withCurrentBuffer(ordering: ordering) { header, _ in
+      header.pointee.capacity
+    }
+  }
+
+  /// Returns a pointer to the slot for the element at the given position in
+  /// the current buffer. The pointer remains valid until the deque is
+  /// destroyed.
+  @inlinable
+  @inline(__always)
+  internal func _currentElementPointer(
+    at position: Int,
+    ordering: AtomicLoadOrdering
+  ) -> UnsafeMutablePointer<Element> {
+    _withCurrentBuffer(ordering: ordering) { header, elements in
+      elements + (position & (header.pointee.capacity &- 1))
+    }
+  }
+
+  /// The number of elements currently in the deque.
+  ///
+  /// If the deque is being accessed concurrently, the returned value is only
+  /// a snapshot that may be out of date by the time it is returned.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var count: Int {
+    let top = _top.load(ordering: .acquiring)
+    let bottom = _bottom.load(ordering: .acquiring)
+    return Swift.max(0, bottom &- top)
+  }
+
+  /// A Boolean value indicating whether the deque is currently empty.
+  ///
+  /// If the deque is being accessed concurrently, the returned value is only
+  /// a snapshot that may be out of date by the time it is returned.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var isEmpty: Bool {
+    count == 0
+  }
+
+  /// The number of elements the deque can hold before it needs to allocate a
+  /// larger buffer.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var capacity: Int {
+    _currentCapacity(ordering: .acquiring)
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension WorkStealingDeque {
+  /// Replace the current buffer with a larger one, moving over the elements
+  /// between `top` and `bottom`. The old buffer is retained, as thieves may
+  /// still be reading from it.
+  @usableFromInline
+  internal func _grow(top: Int, bottom: Int) {
+    let old = _buffers.last!
+    let newCapacity = old._growCapacity(
+      to: old.capacity + 1,
+      linearly: false
+    )._roundUpToPowerOfTwo()
+    let new = _Storage(exactCapacity: newCapacity)
+    old.read { source in
+      new.update { target in
+        let sourceMask = source.capacity &- 1
+        let targetMask = target.capacity &- 1
+        for position in top ..< bottom {
+          // This is a bitwise copy rather than a proper move, because thieves
+          // may concurrently read the same element from the old buffer. Only
+          // one of the copies is ever consumed.
+          UnsafeMutableRawPointer(target.ptr(at: _Slot(at: position & targetMask)))
+            .copyMemory(
+              from: source.ptr(at: _Slot(at: position & sourceMask)),
+              byteCount: MemoryLayout<Element>.size)
+        }
+      }
+    }
+    _buffers.append(new)
+    _buffer.store(
+      Unmanaged.passUnretained(Self._object(of: new)),
+      ordering: .releasing)
+  }
+
+  /// Adds an element to the bottom of the deque, growing its buffer if
+  /// necessary.
+  ///
+  /// This is an owner operation.
+  ///
+  /// - Parameter element: The element to push.
+  ///
+  /// - Complexity: Amortized O(1).
+  @inlinable
+  public func push(_ element: __owned Element) {
+    let bottom = _bottom.load(ordering: .relaxed)
+    let top = _top.load(ordering: .acquiring)
+    // Only the owner replaces the buffer, so relaxed loads see the latest.
+    if _slowPath(bottom &- top >= _currentCapacity(ordering: .relaxed)) {
+      _grow(top: top, bottom: bottom)
+    }
+    _currentElementPointer(at: bottom, ordering: .relaxed)
+      .initialize(to: element)
+    _bottom.store(bottom &+ 1, ordering: .releasing)
+  }
+
+  /// Removes and returns the element at the bottom of the deque (i.e., the
+  /// one that was pushed most recently), if any.
+  ///
+  /// This is an owner operation.
+  ///
+  /// - Returns: The most recently pushed element that hasn't been popped or
+  ///    stolen yet, or `nil` if the deque is empty.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public func pop() -> Element? {
+    let bottom = _bottom.load(ordering: .relaxed) &- 1
+    let source = _currentElementPointer(at: bottom, ordering: .relaxed)
+    // Reserve the bottom element before looking at `_top`, so that thieves
+    // that haven't yet passed their check can no longer take it.
+    _bottom.store(bottom, ordering: .sequentiallyConsistent)
+    let top = _top.load(ordering: .sequentiallyConsistent)
+    guard top <= bottom else {
+      // The deque was empty.
+      _bottom.store(bottom &+ 1, ordering: .relaxed)
+      return nil
+    }
+    if top < bottom {
+      // There is more than one element; the bottom one is ours alone.
+      return source.move()
+    }
+    // This is the last element; we need to race thieves for it.
+    let (won, _) = _top.compareExchange(
+      expected: top,
+      desired: top &+ 1,
+      ordering: .sequentiallyConsistent)
+    _bottom.store(bottom &+ 1, ordering: .relaxed)
+    guard won else { return nil }
+    return source.move()
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension WorkStealingDeque {
+  /// Attempts once to remove and return the element at the top of the deque
+  /// (i.e., the oldest one).
+  ///
+  /// This operation can be called from any thread.
+  ///
+  /// - Returns: The oldest element in the deque, or `nil` if the deque was
+  ///    empty or another thread removed the same element first.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public func trySteal() -> Element? {
+    _steal().element
+  }
+
+  /// Removes and returns the element at the top of the deque (i.e., the
+  /// oldest one), retrying if other threads get in the way.
+  ///
+  /// This operation can be called from any thread.
+  ///
+  /// - Returns: The oldest element in the deque, or `nil` if the deque was
+  ///    found to be empty.
+  @inlinable
+  public func steal() -> Element? {
+    while true {
+      let (element, isEmpty) = _steal()
+      if let element { return element }
+      if isEmpty { return nil }
+    }
+  }
+
+  @inlinable
+  internal func _steal() -> (element: Element?, isEmpty: Bool) {
+    let top = _top.load(ordering: .sequentiallyConsistent)
+    let bottom = _bottom.load(ordering: .sequentiallyConsistent)
+    guard top < bottom else { return (nil, true) }
+    let source = _currentElementPointer(at: top, ordering: .acquiring)
+    // Copy the element's bits without taking ownership of them: until the
+    // compare-and-exchange below succeeds, the element may be taken by the
+    // owner or another thief.
+    return withUnsafeTemporaryAllocation(
+      of: Element.self, capacity: 1
+    ) { buffer in
+      let copy = buffer.baseAddress!
+      UnsafeMutableRawPointer(copy).copyMemory(
+        from: source, byteCount: MemoryLayout<Element>.size)
+      let (won, _) = _top.compareExchange(
+        expected: top,
+        desired: top &+ 1,
+        ordering: .sequentiallyConsistent)
+      guard won else { return (nil, false) }
+      return (copy.move(), false)
+    }
+  }
+}
+#endif
@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+/// A simple backoff strategy for threads waiting on a concurrent data
+/// structure to change state. The first few attempts retry immediately; after
+/// that, the waiting thread yields its processor to other threads before each
+/// retry.
+@frozen
+@usableFromInline
+internal struct _Backoff {
+  @usableFromInline
+  internal var _attempts: Int
+
+  @inlinable
+  internal init() {
+    _attempts = 0
+  }
+
+  @inlinable
+  @inline(__always)
+  internal static var _spinLimit: Int { 16 }
+
+  @inlinable
+  internal mutating func wait() {
+    if _attempts < Self._spinLimit {
+      _attempts &+= 1
+      return
+    }
+    _yieldThread()
+  }
+}
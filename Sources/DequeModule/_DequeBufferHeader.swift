@@ -21,13 +21,32 @@ internal struct _DequeBufferHeader {
   var startSlot: _DequeSlot
 
   @usableFromInline
-  init(capacity: Int, count: Int, startSlot: _DequeSlot) {
+  var policy: DequeStoragePolicy
+
+  @usableFromInline
+  init(
+    capacity: Int,
+    count: Int,
+    startSlot: _DequeSlot,
+    policy: DequeStoragePolicy = .default
+  ) {
     self.capacity = capacity
     self.count = count
     self.startSlot = startSlot
+    self.policy = policy
     _checkInvariants()
   }
 
+  /// Returns true if the storage policy calls for reallocating this buffer
+  /// into a smaller one, given its current count.
+  @inlinable
+  @inline(__always)
+  internal var shouldShrink: Bool {
+    policy.shrinkThreshold > 0
+    && capacity > policy.minimumCapacity
+    && Double(count) < policy.shrinkThreshold * Double(capacity)
+  }
+
   #if COLLECTIONS_INTERNAL_CHECKS
   @usableFromInline @inline(never) @_effects(releasenone)
   internal func _checkInvariants() {
@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+extension AddressableHeap {
+  /// True if consistency checking is enabled in the implementation of this
+  /// type, false otherwise.
+  ///
+  /// Documented performance promises are null and void when this property
+  /// returns true -- for example, operations that are documented to take
+  /// O(1) time might take O(*n*) time, or worse.
+  public static var _isConsistencyCheckingEnabled: Bool {
+    _isCollectionsInternalCheckingEnabled
+  }
+
+  #if COLLECTIONS_INTERNAL_CHECKS
+  /// Verifies that the contents satisfy the min-max heap property, and that
+  /// the position map is in sync with the heap's storage.
+  @inlinable
+  @inline(never)
+  internal func _checkInvariants() {
+    var inUse = 0
+    for slot in 0 ..< _slots.count where _slots[slot].isInUse {
+      let offset = _slots[slot].offset
+      precondition(offset < _storage.count,
+                   "Slot \(slot) refers to invalid offset \(offset)")
+      precondition(_storage[offset].slot == slot,
+                   "Slot \(slot) is out of sync with offset \(offset)")
+      inUse += 1
+    }
+    precondition(inUse == _storage.count, "Position map has stray entries")
+
+    var free = 0
+    var next = _firstFreeSlot
+    while next >= 0 {
+      precondition(!_slots[next].isInUse, "Slot \(next) is not free")
+      free += 1
+      precondition(free <= _slots.count, "Cycle in free list")
+      next = _slots[next].nextFreeSlot
+    }
+    precondition(inUse + free == _slots.count, "Leaked slots")
+
+    guard count > 1 else { return }
+    _checkInvariants(node: .root, min: nil, max: nil)
+  }
+
+  @inlinable
+  internal func _checkInvariants(node: _HeapNode, min: Element?, max: Element?) {
+    let value = _storage[node.offset].element
+    if let min = min {
+      precondition(value >= min,
+                   "Element \(value) at \(node) is less than min \(min)")
+    }
+    if let max = max {
+      precondition(value <= max,
+                   "Element \(value) at \(node) is greater than max \(max)")
+    }
+    let left = node.leftChild()
+    let right = node.rightChild()
+    if node.isMinLevel {
+      if left.offset < count {
+        _checkInvariants(node: left, min: value, max: max)
+      }
+      if right.offset < count {
+        _checkInvariants(node: right, min: value, max: max)
+      }
+    } else {
+      if left.offset < count {
+        _checkInvariants(node: left, min: min, max: value)
+      }
+      if right.offset < count {
+        _checkInvariants(node: right, min: min, max: value)
+      }
+    }
+  }
+  #else
+  @inlinable
+  @inline(__always)
+  public func _checkInvariants() {}
+  #endif  // COLLECTIONS_INTERNAL_CHECKS
+}
@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension AddressableHeap {
+  /// An unsafe view of the storage and the position map of an addressable
+  /// heap.
+  ///
+  /// The heap algorithms are shared with `Heap`; this type only implements
+  /// the primitive operations that move items in storage, each of which
+  /// updates the position map entry of every item it places at a new
+  /// location.
+  @usableFromInline @frozen
+  struct _UnsafeHandle: _MinMaxHeapHandle {
+    @usableFromInline
+    typealias Item = _Entry
+
+    @usableFromInline
+    var entries: UnsafeMutableBufferPointer<_Entry>
+
+    @usableFromInline
+    var slots: UnsafeMutablePointer<_AddressableHeapSlot>
+
+    @inlinable @inline(__always)
+    init(
+      entries: UnsafeMutableBufferPointer<_Entry>,
+      slots: UnsafeMutablePointer<_AddressableHeapSlot>
+    ) {
+      self.entries = entries
+      self.slots = slots
+    }
+  }
+
+  @inlinable @inline(__always)
+  mutating func _update<R>(_ body: (_UnsafeHandle) -> R) -> R {
+    assert(!_storage.isEmpty && !_slots.isEmpty)
+    return _storage.withUnsafeMutableBufferPointer { entries in
+      _slots.withUnsafeMutableBufferPointer { slots in
+        body(_UnsafeHandle(entries: entries, slots: slots.baseAddress!))
+      }
+    }
+  }
+}
+
+extension AddressableHeap._UnsafeHandle {
+  @inlinable @inline(__always)
+  internal var count: Int {
+    entries.count
+  }
+
+  @inlinable
+  subscript(node: _HeapNode) -> _Entry {
+    @inline(__always)
+    get {
+      entries[node.offset]
+    }
+  }
+
+  @inlinable @inline(__always)
+  internal func ptr(to node: _HeapNode) -> UnsafeMutablePointer<_Entry> {
+    assert(node.offset < count)
+    return entries.baseAddress! + node.offset
+  }
+
+  /// Records that the item in the given slot is now at the specified node.
+  @inlinable @inline(__always)
+  internal func _setPosition(ofSlot slot: Int, to node: _HeapNode) {
+    slots[slot].offset = node.offset
+  }
+
+  /// Move the value at the specified node out of the buffer, leaving it
+  /// uninitialized.
+  ///
+  /// The position map keeps pointing at `node` until the value is put back
+  /// with `initialize(_:to:)` or `swapAt(_:with:)`.
+  @inlinable @inline(__always)
+  internal func extract(_ node: _HeapNode) -> _Entry {
+    ptr(to: node).move()
+  }
+
+  @inlinable @inline(__always)
+  internal func initialize(_ node: _HeapNode, to value: __owned _Entry) {
+    _setPosition(ofSlot: value.slot, to: node)
+    ptr(to: node).initialize(to: value)
+  }
+
+  /// Swaps the items at the given nodes, updating their positions.
+  @inlinable @inline(__always)
+  internal func swapAt(_ i: _HeapNode, _ j: _HeapNode) {
+    entries.swapAt(i.offset, j.offset)
+    _setPosition(ofSlot: entries[i.offset].slot, to: i)
+    _setPosition(ofSlot: entries[j.offset].slot, to: j)
+  }
+
+  /// Swaps the item at the given node with the supplied value, updating the
+  /// position of the value that ends up in the heap.
+  @inlinable @inline(__always)
+  internal func swapAt(_ i: _HeapNode, with value: inout _Entry) {
+    swap(&ptr(to: i).pointee, &value)
+    _setPosition(ofSlot: entries[i.offset].slot, to: i)
+  }
+}
+
+extension AddressableHeap._UnsafeHandle {
+  /// Restore the heap property after the item at `node` has been replaced
+  /// with an arbitrary new value.
+  ///
+  /// The new value is first bubbled up towards the root. If that moves it,
+  /// then the item that takes its place at `node` may be out of order with
+  /// respect to the descendants of `node` (for example, when a max-level
+  /// parent gets swapped down to a min level), so it is then sunk into
+  /// place.
+  @inlinable
+  internal func restoreOrder(at node: _HeapNode) {
+    bubbleUp(node)
+    if node.isMinLevel {
+      trickleDownMin(node)
+    } else {
+      trickleDownMax(node)
+    }
+  }
+}
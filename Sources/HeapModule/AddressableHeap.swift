@@ -0,0 +1,451 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A double-ended priority queue that hands out stable handles to its
+/// elements, allowing them to be looked up, updated and removed after they
+/// were inserted.
+///
+/// `AddressableHeap` implements the same min-max heap data structure as
+/// `Heap`, and it provides the same logarithmic-time insertion and removal of
+/// its minimal and maximal items. In addition, `insert(_:)` returns a
+/// `Handle` that identifies the newly inserted item for as long as it remains
+/// in the heap. Handles make it possible to change the priority of a queued
+/// item, or to remove it early, without having to rebuild the heap or
+/// leaving stale entries around:
+///
+///     var frontier = AddressableHeap<Int>()
+///     let a = frontier.insert(30)
+///     let b = frontier.insert(20)
+///     frontier.update(a, to: 10)   // decrease-key
+///     print(frontier.min)          // 10
+///     frontier.remove(b)
+///     print(frontier.count)        // 1
+///     print(frontier.contains(b))  // false
+///
+/// To implement this, the heap keeps a position map that records the current
+/// location of every item in its storage. The map is updated whenever the
+/// heap moves an item, so looking up a handle takes O(1) time, while updating
+/// or removing it takes O(log(`count`)) comparisons.
+///
+/// Handles are only meaningful for the heap that issued them (or copies of
+/// it). Once an item is removed, its handle becomes invalid: `contains(_:)`
+/// returns false for it, and other operations trap. Handles of removed items
+/// are never reused, even though the heap recycles their internal storage.
+@frozen
+public struct AddressableHeap<Element: Comparable> {
+  /// The items in the heap, arranged in min-max heap order.
+  @usableFromInline
+  internal var _storage: ContiguousArray<_Entry>
+
+  /// The position map, indexed by the slot numbers of handles.
+  @usableFromInline
+  internal var _slots: ContiguousArray<_AddressableHeapSlot>
+
+  /// The first slot in the free list, or -1 if the free list is empty.
+  @usableFromInline
+  internal var _firstFreeSlot: Int
+
+  /// Creates an empty heap.
+  @inlinable
+  public init() {
+    _storage = []
+    _slots = []
+    _firstFreeSlot = -1
+  }
+
+  /// Creates an empty heap with preallocated space for at least the
+  /// specified number of elements.
+  ///
+  /// - Parameter minimumCapacity: The minimum number of elements that the newly
+  ///   created heap should be able to store without reallocating its storage.
+  ///
+  /// - Complexity: O(1) allocations
+  @inlinable
+  public init(minimumCapacity: Int) {
+    self.init()
+    self.reserveCapacity(minimumCapacity)
+  }
+}
+
+extension AddressableHeap: Sendable where Element: Sendable {}
+
+extension AddressableHeap {
+  /// A stable reference to an item in an addressable heap.
+  @frozen
+  public struct Handle: Hashable, Sendable {
+    @usableFromInline
+    internal var _slot: Int
+
+    @usableFromInline
+    internal var _generation: Int
+
+    @inlinable
+    internal init(_slot: Int, generation: Int) {
+      self._slot = _slot
+      self._generation = generation
+    }
+  }
+
+  @frozen
+  @usableFromInline
+  internal struct _Entry {
+    @usableFromInline
+    internal var element: Element
+
+    @usableFromInline
+    internal var slot: Int
+
+    @inlinable
+    internal init(element: Element, slot: Int) {
+      self.element = element
+      self.slot = slot
+    }
+  }
+}
+
+// Entries are ordered by their elements, so that the min-max heap algorithms
+// shared with `Heap` can work on them directly.
+extension AddressableHeap._Entry: Comparable {
+  @inlinable @inline(__always)
+  internal static func ==(left: Self, right: Self) -> Bool {
+    left.element == right.element
+  }
+
+  @inlinable @inline(__always)
+  internal static func <(left: Self, right: Self) -> Bool {
+    left.element < right.element
+  }
+}
+
+/// An entry in the position map of an addressable heap.
+///
+/// For slots in use, `offset` is the position of the corresponding item in
+/// heap storage. Free slots form a singly linked list, with a negative
+/// `offset` encoding the next free slot: -1 marks the end of the list, and
+/// `-2 - n` links to slot `n`.
+@frozen
+@usableFromInline
+internal struct _AddressableHeapSlot {
+  @usableFromInline
+  internal var offset: Int
+
+  /// Incremented every time this slot is freed, to invalidate old handles.
+  @usableFromInline
+  internal var generation: Int
+
+  @inlinable
+  internal init(offset: Int, generation: Int) {
+    self.offset = offset
+    self.generation = generation
+  }
+
+  @inlinable @inline(__always)
+  internal var isInUse: Bool { offset >= 0 }
+
+  @inlinable @inline(__always)
+  internal var nextFreeSlot: Int {
+    assert(!isInUse)
+    return -2 &- offset
+  }
+}
+
+extension AddressableHeap {
+  /// A Boolean value indicating whether or not the heap is empty.
+  ///
+  /// - Complexity: O(1)
+  @inlinable @inline(__always)
+  public var isEmpty: Bool {
+    _storage.isEmpty
+  }
+
+  /// The number of elements in the heap.
+  ///
+  /// - Complexity: O(1)
+  @inlinable @inline(__always)
+  public var count: Int {
+    _storage.count
+  }
+
+  /// An array containing the elements of the heap, in no particular order.
+  ///
+  /// - Complexity: O(`count`)
+  @inlinable
+  public var unordered: [Element] {
+    _storage.map { $0.element }
+  }
+
+  /// Reserves enough space to store the specified number of elements.
+  ///
+  /// - Parameter minimumCapacity: The minimum number of elements that the
+  ///   resulting heap should be able to store without reallocating its storage.
+  ///
+  /// - Complexity: O(`count`)
+  @inlinable
+  public mutating func reserveCapacity(_ minimumCapacity: Int) {
+    _storage.reserveCapacity(minimumCapacity)
+    _slots.reserveCapacity(minimumCapacity)
+  }
+
+  /// Returns the element with the lowest priority, if available.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var min: Element? {
+    _storage.first?.element
+  }
+
+  /// Returns the element with the highest priority, if available.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var max: Element? {
+    guard let offset = _maxOffset else { return nil }
+    return _storage[offset].element
+  }
+
+  /// Returns the handle of the element with the lowest priority, if
+  /// available.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var minHandle: Handle? {
+    guard !isEmpty else { return nil }
+    return _handle(forSlot: _storage[0].slot)
+  }
+
+  /// Returns the handle of the element with the highest priority, if
+  /// available.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var maxHandle: Handle? {
+    guard let offset = _maxOffset else { return nil }
+    return _handle(forSlot: _storage[offset].slot)
+  }
+
+  @inlinable
+  internal var _maxOffset: Int? {
+    switch count {
+    case 0: return nil
+    case 1: return 0
+    case 2: return 1
+    default:
+      return _storage[1].element < _storage[2].element ? 2 : 1
+    }
+  }
+
+  @inlinable @inline(__always)
+  internal func _handle(forSlot slot: Int) -> Handle {
+    Handle(_slot: slot, generation: _slots[slot].generation)
+  }
+
+  /// Returns a Boolean value indicating whether the item identified by the
+  /// given handle is still in the heap.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public func contains(_ handle: Handle) -> Bool {
+    guard handle._slot >= 0, handle._slot < _slots.count else { return false }
+    let slot = _slots[handle._slot]
+    return slot.isInUse && slot.generation == handle._generation
+  }
+
+  /// Returns the current storage offset of the item identified by `handle`,
+  /// trapping if the handle is no longer valid.
+  @inlinable
+  internal func _offset(of handle: Handle) -> Int {
+    precondition(contains(handle), "Invalid or stale heap handle")
+    return _slots[handle._slot].offset
+  }
+
+  /// Accesses the element identified by the given handle.
+  ///
+  /// The handle must identify an item that is currently in the heap.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public subscript(handle: Handle) -> Element {
+    _storage[_offset(of: handle)].element
+  }
+}
+
+extension AddressableHeap {
+  /// Inserts the given element into the heap, and returns a handle that
+  /// identifies it.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func insert(_ element: Element) -> Handle {
+    let offset = _storage.count
+    let slot: Int
+    if _firstFreeSlot >= 0 {
+      slot = _firstFreeSlot
+      _firstFreeSlot = _slots[slot].nextFreeSlot
+      _slots[slot].offset = offset
+    } else {
+      slot = _slots.count
+      _slots.append(_AddressableHeapSlot(offset: offset, generation: 0))
+    }
+    _storage.append(_Entry(element: element, slot: slot))
+    _update { handle in
+      handle.bubbleUp(_HeapNode(offset: offset))
+    }
+    _checkInvariants()
+    return _handle(forSlot: slot)
+  }
+
+  /// Replaces the element identified by the given handle with a new value,
+  /// then updates the heap to reflect the change in priority. The handle
+  /// remains valid.
+  ///
+  /// This implements both the decrease-key and increase-key operations of
+  /// classic priority queues.
+  ///
+  /// - Parameters:
+  ///   - handle: A handle identifying an item that is currently in the heap.
+  ///   - newValue: The new value of the item.
+  ///
+  /// - Returns: The original value of the item.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func update(
+    _ handle: Handle,
+    to newValue: Element
+  ) -> Element {
+    let offset = _offset(of: handle)
+    var old = newValue
+    _update { h in
+      let node = _HeapNode(offset: offset)
+      swap(&h.entries[offset].element, &old)
+      h.restoreOrder(at: node)
+    }
+    _checkInvariants()
+    return old
+  }
+
+  /// Removes the element identified by the given handle from the heap, and
+  /// invalidates the handle.
+  ///
+  /// - Parameter handle: A handle identifying an item that is currently in
+  ///    the heap.
+  ///
+  /// - Returns: The removed element.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func remove(_ handle: Handle) -> Element {
+    _remove(at: _offset(of: handle))
+  }
+
+  /// Removes and returns the element with the lowest priority, if available.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  public mutating func popMin() -> Element? {
+    guard !isEmpty else { return nil }
+    return _remove(at: 0)
+  }
+
+  /// Removes and returns the element with the highest priority, if available.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  public mutating func popMax() -> Element? {
+    guard let offset = _maxOffset else { return nil }
+    return _remove(at: offset)
+  }
+
+  /// Removes and returns the element with the lowest priority.
+  ///
+  /// The heap *must not* be empty.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func removeMin() -> Element {
+    return popMin()!
+  }
+
+  /// Removes and returns the element with the highest priority.
+  ///
+  /// The heap *must not* be empty.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func removeMax() -> Element {
+    return popMax()!
+  }
+
+  /// Removes all elements from the heap, invalidating all handles.
+  ///
+  /// - Parameter keepCapacity: Pass true to keep the existing storage
+  ///    capacity of the heap after removing its elements. The default value
+  ///    is false.
+  ///
+  /// - Complexity: O(`count`)
+  @inlinable
+  public mutating func removeAll(keepingCapacity keepCapacity: Bool = false) {
+    // Free slots individually, so that outstanding handles are invalidated
+    // rather than aliased by future insertions.
+    while let entry = _storage.popLast() {
+      _freeSlot(entry.slot)
+    }
+    if !keepCapacity {
+      _storage = []
+    }
+    _checkInvariants()
+  }
+
+  @inlinable
+  internal mutating func _remove(at offset: Int) -> Element {
+    let last = _storage.count - 1
+    if offset < last {
+      _update { h in
+        h.swapAt(_HeapNode(offset: offset), _HeapNode(offset: last))
+      }
+    }
+    let removed = _storage.removeLast()
+    _freeSlot(removed.slot)
+    if offset < last {
+      _update { h in
+        h.restoreOrder(at: _HeapNode(offset: offset))
+      }
+    }
+    _checkInvariants()
+    return removed.element
+  }
+
+  @inlinable
+  internal mutating func _freeSlot(_ slot: Int) {
+    _slots[slot].offset = -2 &- _firstFreeSlot
+    _slots[slot].generation &+= 1
+    _firstFreeSlot = slot
+  }
+}
+
+extension AddressableHeap: CustomStringConvertible {
+  /// A textual representation of this instance.
+  public var description: String {
+    "<\(count) item\(count == 1 ? "" : "s")>"
+  }
+}
+
+extension AddressableHeap: CustomDebugStringConvertible {
+  /// A textual representation of this instance, suitable for debugging.
+  public var debugDescription: String {
+    description
+  }
+}
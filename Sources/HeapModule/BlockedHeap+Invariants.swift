@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+extension BlockedHeap {
+  /// True if consistency checking is enabled in the implementation of this
+  /// type, false otherwise.
+  ///
+  /// Documented performance promises are null and void when this property
+  /// returns true -- for example, operations that are documented to take
+  /// O(1) time might take O(*n*) time, or worse.
+  public static var _isConsistencyCheckingEnabled: Bool {
+    _isCollectionsInternalCheckingEnabled
+  }
+
+  #if COLLECTIONS_INTERNAL_CHECKS
+  /// Visits each node in the tree and verifies that the min-max heap property
+  /// holds, and that the navigation methods of the blocked layout agree with
+  /// each other.
+  @inlinable
+  @inline(never)
+  internal func _checkInvariants() {
+    guard count > 1 else { return }
+    var visited = 0
+    _checkInvariants(node: .root, min: nil, max: nil, visited: &visited)
+    precondition(visited == count, "Some items are unreachable from the root")
+  }
+
+  @inlinable
+  internal func _checkInvariants(
+    node: _BlockedHeapNode,
+    min: Element?,
+    max: Element?,
+    visited: inout Int
+  ) {
+    let h = Self._blockHeight
+    visited += 1
+    precondition(
+      _BlockedHeapNode(offset: node.offset, blockHeight: h).level == node.level,
+      "Node \(node) is at the wrong level")
+    let value = _storage[node.offset]
+    if let min = min {
+      precondition(value >= min,
+                   "Element \(value) at \(node) is less than min \(min)")
+    }
+    if let max = max {
+      precondition(value <= max,
+                   "Element \(value) at \(node) is greater than max \(max)")
+    }
+    for child in [node.leftChild(blockHeight: h), node.rightChild(blockHeight: h)]
+    where child.offset < count {
+      precondition(child.parent(blockHeight: h) == node,
+                   "Node \(child) doesn't lead back to its parent \(node)")
+      if node.isMinLevel {
+        _checkInvariants(node: child, min: value, max: max, visited: &visited)
+      } else {
+        _checkInvariants(node: child, min: min, max: value, visited: &visited)
+      }
+    }
+  }
+  #else
+  @inlinable
+  @inline(__always)
+  public func _checkInvariants() {}
+  #endif  // COLLECTIONS_INTERNAL_CHECKS
+}
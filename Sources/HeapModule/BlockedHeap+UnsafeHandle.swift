@@ -0,0 +1,245 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension BlockedHeap {
+  /// An unsafe view of the storage of a blocked heap, implementing the
+  /// min-max heap algorithms on top of the blocked tree layout.
+  ///
+  /// These mirror the corresponding operations on `Heap._UnsafeHandle`,
+  /// except that children and grandchildren of a node aren't necessarily
+  /// adjacent, so every step goes through the navigation methods of
+  /// `_BlockedHeapNode`.
+  @usableFromInline @frozen
+  struct _UnsafeHandle {
+    @usableFromInline
+    var buffer: UnsafeMutableBufferPointer<Element>
+
+    @inlinable @inline(__always)
+    init(_ buffer: UnsafeMutableBufferPointer<Element>) {
+      self.buffer = buffer
+    }
+  }
+
+  @inlinable @inline(__always)
+  mutating func _update<R>(_ body: (_UnsafeHandle) -> R) -> R {
+    _storage.withUnsafeMutableBufferPointer { body(_UnsafeHandle($0)) }
+  }
+}
+
+extension BlockedHeap._UnsafeHandle {
+  @inlinable @inline(__always)
+  internal var count: Int {
+    buffer.count
+  }
+
+  @inlinable @inline(__always)
+  internal var blockHeight: Int {
+    BlockedHeap._blockHeight
+  }
+
+  @inlinable @inline(__always)
+  internal func node(at offset: Int) -> _BlockedHeapNode {
+    _BlockedHeapNode(offset: offset, blockHeight: blockHeight)
+  }
+
+  @inlinable
+  subscript(node: _BlockedHeapNode) -> Element {
+    @inline(__always)
+    get {
+      buffer[node.offset]
+    }
+  }
+
+  @inlinable @inline(__always)
+  internal func swapAt(_ i: _BlockedHeapNode, _ j: _BlockedHeapNode) {
+    buffer.swapAt(i.offset, j.offset)
+  }
+
+  @inlinable @inline(__always)
+  internal func swapAt(_ i: _BlockedHeapNode, with value: inout Element) {
+    swap(&buffer[i.offset], &value)
+  }
+
+  @inlinable @inline(__always)
+  internal func minValue(
+    _ a: _BlockedHeapNode, _ b: _BlockedHeapNode
+  ) -> _BlockedHeapNode {
+    self[a] < self[b] ? a : b
+  }
+
+  @inlinable @inline(__always)
+  internal func maxValue(
+    _ a: _BlockedHeapNode, _ b: _BlockedHeapNode
+  ) -> _BlockedHeapNode {
+    self[a] < self[b] ? b : a
+  }
+}
+
+extension BlockedHeap._UnsafeHandle {
+  @inlinable
+  internal func bubbleUp(_ node: _BlockedHeapNode) {
+    guard !node.isRoot else { return }
+    let h = blockHeight
+
+    let parent = node.parent(blockHeight: h)
+
+    var node = node
+    if (node.isMinLevel && self[node] > self[parent])
+        || (!node.isMinLevel && self[node] < self[parent]){
+      swapAt(node, parent)
+      node = parent
+    }
+
+    if node.isMinLevel {
+      while let grandparent = node.grandParent(blockHeight: h),
+            self[node] < self[grandparent] {
+        swapAt(node, grandparent)
+        node = grandparent
+      }
+    } else {
+      while let grandparent = node.grandParent(blockHeight: h),
+            self[node] > self[grandparent] {
+        swapAt(node, grandparent)
+        node = grandparent
+      }
+    }
+  }
+
+  /// Returns the node holding the minimal item amongst the children and
+  /// grandchildren of `node`, or nil if `node` is a leaf.
+  ///
+  /// Because the storage is filled one block at a time, the left child of a
+  /// node may have children of its own even if the right child is missing,
+  /// so each candidate is checked separately.
+  @inlinable
+  internal func _minDescendant(
+    of node: _BlockedHeapNode
+  ) -> _BlockedHeapNode? {
+    let h = blockHeight
+    let c0 = node.leftChild(blockHeight: h)
+    guard c0.offset < count else { return nil }
+    var min = c0
+    let gc0 = c0.leftChild(blockHeight: h)
+    if gc0.offset < count {
+      min = minValue(min, gc0)
+      let gc1 = c0.rightChild(blockHeight: h)
+      if gc1.offset < count {
+        min = minValue(min, gc1)
+      }
+    }
+    let c1 = node.rightChild(blockHeight: h)
+    guard c1.offset < count else { return min }
+    min = minValue(min, c1)
+    let gc2 = c1.leftChild(blockHeight: h)
+    if gc2.offset < count {
+      min = minValue(min, gc2)
+      let gc3 = c1.rightChild(blockHeight: h)
+      if gc3.offset < count {
+        min = minValue(min, gc3)
+      }
+    }
+    return min
+  }
+
+  /// Returns the node holding the maximal item amongst the children and
+  /// grandchildren of `node`, or nil if `node` is a leaf.
+  @inlinable
+  internal func _maxDescendant(
+    of node: _BlockedHeapNode
+  ) -> _BlockedHeapNode? {
+    let h = blockHeight
+    let c0 = node.leftChild(blockHeight: h)
+    guard c0.offset < count else { return nil }
+    var max = c0
+    let gc0 = c0.leftChild(blockHeight: h)
+    if gc0.offset < count {
+      max = maxValue(max, gc0)
+      let gc1 = c0.rightChild(blockHeight: h)
+      if gc1.offset < count {
+        max = maxValue(max, gc1)
+      }
+    }
+    let c1 = node.rightChild(blockHeight: h)
+    guard c1.offset < count else { return max }
+    max = maxValue(max, c1)
+    let gc2 = c1.leftChild(blockHeight: h)
+    if gc2.offset < count {
+      max = maxValue(max, gc2)
+      let gc3 = c1.rightChild(blockHeight: h)
+      if gc3.offset < count {
+        max = maxValue(max, gc3)
+      }
+    }
+    return max
+  }
+
+  /// Sink the item at `node` to its correct position in the heap.
+  /// The given node must be minimum-ordered.
+  @inlinable
+  internal func trickleDownMin(_ node: _BlockedHeapNode) {
+    assert(node.isMinLevel)
+    let h = blockHeight
+    var node = node
+    while let min = _minDescendant(of: node), self[min] < self[node] {
+      swapAt(min, node)
+      guard min.level == node.level &+ 2 else { return }
+      // `min` was a grandchild; the value we're sinking may now be larger
+      // than the max-level node between them.
+      let parent = min.parent(blockHeight: h)
+      if self[parent] < self[min] {
+        swapAt(min, parent)
+      }
+      node = min
+    }
+  }
+
+  /// Sink the item at `node` to its correct position in the heap.
+  /// The given node must be maximum-ordered.
+  @inlinable
+  internal func trickleDownMax(_ node: _BlockedHeapNode) {
+    assert(!node.isMinLevel)
+    let h = blockHeight
+    var node = node
+    while let max = _maxDescendant(of: node), self[node] < self[max] {
+      swapAt(max, node)
+      guard max.level == node.level &+ 2 else { return }
+      // `max` was a grandchild; the value we're sinking may now be smaller
+      // than the min-level node between them.
+      let parent = max.parent(blockHeight: h)
+      if self[max] < self[parent] {
+        swapAt(max, parent)
+      }
+      node = max
+    }
+  }
+
+  /// Arranges the items in the storage into a valid heap, in O(`count`)
+  /// time.
+  ///
+  /// Every node is stored at a lower offset than its descendants, so
+  /// visiting offsets in descending order visits each node after all of its
+  /// descendants. Unlike in the implicit layout of `Heap`, the internal nodes
+  /// don't form a prefix of the storage: within a block, nodes that precede
+  /// the parent of the last item may still have children. So every offset
+  /// is visited; trickling down a leaf stops after finding no descendants.
+  @inlinable
+  internal func heapify() {
+    guard count > 1 else { return }
+    for offset in stride(from: count &- 1, through: 0, by: -1) {
+      let node = self.node(at: offset)
+      if node.isMinLevel {
+        trickleDownMin(node)
+      } else {
+        trickleDownMax(node)
+      }
+    }
+  }
+}
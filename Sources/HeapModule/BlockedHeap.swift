@@ -0,0 +1,357 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A double-ended priority queue with the same interface as `Heap`, but
+/// with a cache-friendly storage layout that's better suited for very large
+/// heaps.
+///
+/// `Heap` stores its min-max tree in breadth-first order. This is compact and
+/// cheap to navigate, but it means that every step down (or up) the tree
+/// lands at an offset roughly twice as far from the start of the storage as
+/// the previous one. Once a heap outgrows the processor caches, nearly every
+/// level visited by `insert` or `popMin` costs a cache miss.
+///
+/// `BlockedHeap` instead partitions the tree into small complete subtrees of
+/// a fixed height, and stores the nodes of each subtree next to each other.
+/// These blocks are sized to span a couple of cache lines, so walking down a
+/// path in the tree only touches a new block every few levels. The blocks
+/// themselves form a tree with a high fan-out, which is stored in
+/// breadth-first order.
+///
+/// The heap fills its storage one block at a time, so the tree isn't
+/// necessarily complete: its height can exceed that of a `Heap` with the same
+/// number of items by up to one block height. This doesn't affect the
+/// complexity of any operation.
+///
+/// For small heaps that fit in cache, `Heap` is usually faster, as it has
+/// simpler arithmetic for navigating the tree.
+@frozen
+public struct BlockedHeap<Element: Comparable> {
+  @usableFromInline
+  internal var _storage: ContiguousArray<Element>
+
+  /// Creates an empty heap.
+  @inlinable
+  public init() {
+    _storage = []
+  }
+}
+
+extension BlockedHeap: Sendable where Element: Sendable {}
+
+extension BlockedHeap {
+  /// The height of each block of the tree. Each block holds a complete
+  /// subtree of `2^height - 1` nodes.
+  ///
+  /// This is chosen so that a block takes no more than 128 bytes (two cache
+  /// lines on most current processors), with a minimum height of 2 so that
+  /// the two max nodes at the top of the tree are always in the first block.
+  /// (Blocks of elements wider than 42 bytes exceed the limit.)
+  @inlinable @inline(__always)
+  internal static var _blockHeight: Int {
+    let nodesPerBlock = Swift.max(1, 128 / MemoryLayout<Element>.stride)
+    return Swift.max(2, nodesPerBlock._binaryLogarithm())
+  }
+
+  /// A Boolean value indicating whether or not the heap is empty.
+  ///
+  /// - Complexity: O(1)
+  @inlinable @inline(__always)
+  public var isEmpty: Bool {
+    _storage.isEmpty
+  }
+
+  /// The number of elements in the heap.
+  ///
+  /// - Complexity: O(1)
+  @inlinable @inline(__always)
+  public var count: Int {
+    _storage.count
+  }
+
+  /// A read-only view into the underlying array.
+  ///
+  /// Note: The elements aren't _arbitrarily_ ordered. However, no guarantees
+  /// are given as to the ordering of the elements or that this won't change
+  /// in future versions of the library.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var unordered: [Element] {
+    Array(_storage)
+  }
+
+  /// Creates an empty heap with preallocated space for at least the
+  /// specified number of elements.
+  ///
+  /// - Parameter minimumCapacity: The minimum number of elements that the newly
+  ///   created heap should be able to store without reallocating its storage.
+  ///
+  /// - Complexity: O(1) allocations
+  @inlinable
+  public init(minimumCapacity: Int) {
+    self.init()
+    self.reserveCapacity(minimumCapacity)
+  }
+
+  /// Reserves enough space to store the specified number of elements.
+  ///
+  /// - Parameter minimumCapacity: The minimum number of elements that the
+  ///   resulting heap should be able to store without reallocating its storage.
+  ///
+  /// - Complexity: O(`count`)
+  @inlinable
+  public mutating func reserveCapacity(_ minimumCapacity: Int) {
+    _storage.reserveCapacity(minimumCapacity)
+  }
+
+  /// Returns the element with the lowest priority, if available.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var min: Element? {
+    _storage.first
+  }
+
+  /// Returns the element with the highest priority, if available.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var max: Element? {
+    // The first block always contains the root and both of its children, at
+    // the same offsets as in `Heap`.
+    _storage.withUnsafeBufferPointer { buffer in
+      guard buffer.count > 2 else { return buffer.last }
+      return Swift.max(buffer[1], buffer[2])
+    }
+  }
+
+  /// Inserts the given element into the heap.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  public mutating func insert(_ element: Element) {
+    _storage.append(element)
+    _update { handle in
+      handle.bubbleUp(handle.node(at: handle.count - 1))
+    }
+    _checkInvariants()
+  }
+
+  /// Removes and returns the element with the lowest priority, if available.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  public mutating func popMin() -> Element? {
+    guard _storage.count > 0 else { return nil }
+
+    var removed = _storage.removeLast()
+
+    if _storage.count > 0 {
+      _update { handle in
+        let minNode = _BlockedHeapNode.root
+        handle.swapAt(minNode, with: &removed)
+        handle.trickleDownMin(minNode)
+      }
+    }
+
+    _checkInvariants()
+    return removed
+  }
+
+  /// Removes and returns the element with the highest priority, if available.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  public mutating func popMax() -> Element? {
+    guard _storage.count > 2 else { return _storage.popLast() }
+
+    var removed = _storage.removeLast()
+
+    _update { handle in
+      if handle.count == 2 {
+        if handle[.leftMax] > removed {
+          handle.swapAt(.leftMax, with: &removed)
+        }
+      } else {
+        let maxNode = handle.maxValue(.rightMax, .leftMax)
+        handle.swapAt(maxNode, with: &removed)
+        handle.trickleDownMax(maxNode)
+      }
+    }
+
+    _checkInvariants()
+    return removed
+  }
+
+  /// Removes and returns the element with the lowest priority.
+  ///
+  /// The heap *must not* be empty.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func removeMin() -> Element {
+    return popMin()!
+  }
+
+  /// Removes and returns the element with the highest priority.
+  ///
+  /// The heap *must not* be empty.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func removeMax() -> Element {
+    return popMax()!
+  }
+
+  /// Replaces the minimum value in the heap with the given replacement,
+  /// then updates heap contents to reflect the change.
+  ///
+  /// The heap must not be empty.
+  ///
+  /// - Parameter replacement: The value that is to replace the current
+  ///   minimum value.
+  /// - Returns: The original minimum value before the replacement.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func replaceMin(with replacement: Element) -> Element {
+    precondition(!isEmpty, "No element to replace")
+
+    var removed = replacement
+    _update { handle in
+      let minNode = _BlockedHeapNode.root
+      handle.swapAt(minNode, with: &removed)
+      handle.trickleDownMin(minNode)
+    }
+    _checkInvariants()
+    return removed
+  }
+
+  /// Replaces the maximum value in the heap with the given replacement,
+  /// then updates heap contents to reflect the change.
+  ///
+  /// The heap must not be empty.
+  ///
+  /// - Parameter replacement: The value that is to replace the current maximum
+  ///   value.
+  /// - Returns: The original maximum value before the replacement.
+  ///
+  /// - Complexity: O(log(`count`)) element comparisons
+  @inlinable
+  @discardableResult
+  public mutating func replaceMax(with replacement: Element) -> Element {
+    precondition(!isEmpty, "No element to replace")
+
+    var removed = replacement
+    _update { handle in
+      switch handle.count {
+      case 1:
+        handle.swapAt(.root, with: &removed)
+      case 2:
+        handle.swapAt(.leftMax, with: &removed)
+        handle.bubbleUp(.leftMax)
+      default:
+        let maxNode = handle.maxValue(.leftMax, .rightMax)
+        handle.swapAt(maxNode, with: &removed)
+        handle.bubbleUp(maxNode)  // This must happen first
+        handle.trickleDownMax(maxNode)  // Either new element or dethroned min
+      }
+    }
+    _checkInvariants()
+    return removed
+  }
+}
+
+// MARK: -
+
+extension BlockedHeap {
+  /// Initializes a heap from a sequence.
+  ///
+  /// - Complexity: O(*n*), where *n* is the number of items in `elements`.
+  @inlinable
+  public init(_ elements: some Sequence<Element>) {
+    _storage = ContiguousArray(elements)
+    guard _storage.count > 1 else { return }
+
+    _update { handle in
+      handle.heapify()
+    }
+    _checkInvariants()
+  }
+
+  /// Inserts the elements in the given sequence into the heap.
+  ///
+  /// - Parameter newElements: The new elements to insert into the heap.
+  ///
+  /// - Complexity: O(`count` + *k*), where *k* is the length of `newElements`.
+  @inlinable
+  public mutating func insert(
+    contentsOf newElements: some Sequence<Element>
+  ) {
+    let origCount = self.count
+    if origCount == 0 {
+      self = Self(newElements)
+      return
+    }
+    defer { _checkInvariants() }
+    _storage.append(contentsOf: newElements)
+    let newCount = self.count
+    guard newCount > origCount, newCount > 1 else { return }
+
+    // Re-heapifying the entire storage takes O(n) steps, while inserting
+    // the k new items one by one takes O(k log n), so switch to Floyd's
+    // algorithm once k is larger than about 2n / log n.
+    let heuristicLimit = 2 * newCount / newCount._binaryLogarithm()
+    let useFloyd = (newCount - origCount) >= heuristicLimit
+    _update { handle in
+      if useFloyd {
+        handle.heapify()
+      } else {
+        for offset in origCount ..< handle.count {
+          handle.bubbleUp(handle.node(at: offset))
+        }
+      }
+    }
+  }
+}
+
+extension BlockedHeap: ExpressibleByArrayLiteral {
+  /// Creates a new heap from the contents of an array literal.
+  ///
+  /// **Do not call this initializer directly.** It is used by the compiler when
+  /// you use an array literal. Instead, create a new heap using an array
+  /// literal as its value by enclosing a comma-separated list of values in
+  /// square brackets. You can use an array literal anywhere a heap is expected
+  /// by the type context.
+  ///
+  /// - Parameter elements: A variadic list of elements of the new heap.
+  public init(arrayLiteral elements: Element...) {
+    self.init(elements)
+  }
+}
+
+extension BlockedHeap: CustomStringConvertible {
+  /// A textual representation of this instance.
+  public var description: String {
+    "<\(count) item\(count == 1 ? "" : "s")>"
+  }
+}
+
+extension BlockedHeap: CustomDebugStringConvertible {
+  /// A textual representation of this instance, suitable for debugging.
+  public var debugDescription: String {
+    description
+  }
+}
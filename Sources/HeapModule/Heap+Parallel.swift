@@ -0,0 +1,122 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if canImport(Dispatch)
+import Dispatch
+#endif
+
+extension Heap where Element: Sendable {
+  /// Initializes a heap from a sequence, spreading the work of arranging
+  /// large inputs across multiple threads.
+  ///
+  /// Floyd's heap construction algorithm processes the tree from the bottom
+  /// up, and the subtrees below any given level don't depend on each other.
+  /// For large inputs, this initializer cuts the tree at a level with enough
+  /// nodes to keep every processor busy, and heapifies the subtrees below
+  /// that level concurrently. Once they're done, the few remaining levels at
+  /// the top of the tree are fixed up on the calling thread.
+  ///
+  /// The result is the same as that of `init(_:)`. Small inputs, and
+  /// platforms without Dispatch, are always processed on the calling thread.
+  ///
+  /// - Complexity: O(*n*) total work, where *n* is the number of items in
+  ///    `elements`. With *p* processors available, it takes about
+  ///    O(*n*/*p* + log(*n*)^2) time after the elements are copied into
+  ///    the heap's storage.
+  @inlinable
+  public init(parallelizing elements: some Sequence<Element>) {
+    _storage = ContiguousArray(elements)
+    guard _storage.count > 1 else { return }
+
+    _update { handle in
+      handle.heapifyInParallel()
+    }
+    _checkInvariants()
+  }
+}
+
+extension Heap._UnsafeHandle {
+  /// The minimum number of items in a subtree that's worth handing over to
+  /// another thread.
+  @inlinable @inline(__always)
+  internal static var _minimumParallelSubtreeCount: Int { 1 &<< 14 }
+
+  /// The level at which `heapifyInParallel()` splits the tree. There are
+  /// `2^level` subtrees below this level; allowing up to 256 of them lets the
+  /// work spread evenly even though the bottom level of the tree is
+  /// generally incomplete.
+  @inlinable @inline(__always)
+  internal static var _maximumParallelSplitLevel: Int { 8 }
+
+  /// Arranges the items in the storage into a valid heap, heapifying the
+  /// subtrees below a certain level on multiple threads.
+  ///
+  /// The caller must ensure that it is safe to move items across threads.
+  @inlinable
+  internal func heapifyInParallel() {
+    var splitLevel = 0
+    while
+      splitLevel < Self._maximumParallelSplitLevel,
+      count &>> (splitLevel &+ 1) >= Self._minimumParallelSubtreeCount
+    {
+      splitLevel &+= 1
+    }
+    #if canImport(Dispatch)
+    guard splitLevel > 0 else {
+      heapify()
+      return
+    }
+    let rootLevel = splitLevel
+    let firstRoot = _HeapNode.firstNode(onLevel: rootLevel).offset
+    DispatchQueue.concurrentPerform(iterations: 1 &<< rootLevel) { i in
+      _heapifySubtree(
+        at: _HeapNode(offset: firstRoot &+ i, level: rootLevel))
+    }
+
+    // Fix the top of the tree. Items sunk from here can end up deep inside
+    // the subtrees, but these are now valid heaps, so they stay that way.
+    let limit = count / 2 // The first offset without a left child
+    var level = splitLevel &- 1
+    while level >= 0 {
+      _heapify(level, _HeapNode.allNodes(onLevel: level, limit: limit))
+      level &-= 1
+    }
+    #else
+    heapify()
+    #endif
+  }
+
+  /// Runs Floyd's algorithm on the subtree rooted at `root`, leaving the rest
+  /// of the storage untouched.
+  ///
+  /// The descendants of `root` at `d` levels below it form a contiguous
+  /// range of `2^d` nodes, which makes this a straightforward generalization
+  /// of `heapify()`.
+  @inlinable
+  internal func _heapifySubtree(at root: _HeapNode) {
+    let limit = count / 2 // The first offset without a left child
+    guard root.offset < limit else { return }
+    let bottom = _HeapNode.level(forOffset: limit &- 1)
+    var level = bottom
+    while level >= root.level {
+      let depth = level &- root.level
+      let first = ((root.offset &+ 1) &<< depth) &- 1
+      if first < limit {
+        let last = Swift.min(((root.offset &+ 2) &<< depth) &- 2, limit &- 1)
+        let nodes = ClosedRange(uncheckedBounds: (
+          _HeapNode(offset: first, level: level),
+          _HeapNode(offset: last, level: level)))
+        _heapify(level, nodes)
+      }
+      level &-= 1
+    }
+  }
+}
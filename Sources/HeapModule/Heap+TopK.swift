@@ -0,0 +1,173 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension Heap {
+  /// Inserts the given element into the heap, as long as it is one of the
+  /// `k` largest items seen so far, keeping the heap's count at or below `k`.
+  ///
+  /// Use this method to select the best `k` items from a stream without
+  /// having to keep every item around:
+  ///
+  ///     var best = Heap<Int>()
+  ///     for score in [7, 3, 9, 1, 8, 5] {
+  ///       best.insert(score, keepingLargest: 3)
+  ///     }
+  ///     print(best.unordered.sorted())  // [7, 8, 9]
+  ///
+  /// Once the heap is full, each new item is first compared against the
+  /// current minimum. Items that aren't larger than it are rejected without
+  /// touching the heap, so in the common case of a long stream where most
+  /// items don't make the cut, this costs a single comparison. Otherwise the
+  /// minimum is replaced with the new item in a single operation, rather
+  /// than an insertion followed by a separate removal.
+  ///
+  /// If the heap already contains more than `k` items, its smallest items
+  /// are removed first.
+  ///
+  /// - Parameters:
+  ///   - element: The element to insert.
+  ///   - k: The maximum number of items to keep. `k` must be nonnegative.
+  ///
+  /// - Returns: The item that didn't make the cut, if any: either the
+  ///    evicted previous minimum, or `element` itself if it was rejected.
+  ///
+  /// - Complexity: O(1) if `element` is rejected; otherwise O(log(`k`))
+  ///    element comparisons.
+  @inlinable
+  @discardableResult
+  public mutating func insert(
+    _ element: Element,
+    keepingLargest k: Int
+  ) -> Element? {
+    precondition(k >= 0, "Cannot keep a negative number of items")
+    while count > k { _ = popMin() }
+    if count < k {
+      insert(element)
+      return nil
+    }
+    guard let min = self.min, min < element else { return element }
+    return replaceMin(with: element)
+  }
+
+  /// Inserts the given element into the heap, as long as it is one of the
+  /// `k` smallest items seen so far, keeping the heap's count at or below
+  /// `k`.
+  ///
+  /// This is the mirror image of `insert(_:keepingLargest:)`: once the heap
+  /// is full, items that aren't smaller than the current maximum are
+  /// rejected after a single comparison, while others replace the maximum.
+  ///
+  /// If the heap already contains more than `k` items, its largest items are
+  /// removed first.
+  ///
+  /// - Parameters:
+  ///   - element: The element to insert.
+  ///   - k: The maximum number of items to keep. `k` must be nonnegative.
+  ///
+  /// - Returns: The item that didn't make the cut, if any: either the
+  ///    evicted previous maximum, or `element` itself if it was rejected.
+  ///
+  /// - Complexity: O(1) if `element` is rejected; otherwise O(log(`k`))
+  ///    element comparisons.
+  @inlinable
+  @discardableResult
+  public mutating func insert(
+    _ element: Element,
+    keepingSmallest k: Int
+  ) -> Element? {
+    precondition(k >= 0, "Cannot keep a negative number of items")
+    while count > k { _ = popMax() }
+    if count < k {
+      insert(element)
+      return nil
+    }
+    guard let max = self.max, element < max else { return element }
+    return replaceMax(with: element)
+  }
+
+  /// Inserts the elements of the given sequence into the heap, keeping only
+  /// the `k` largest items.
+  ///
+  /// Until the heap fills up, new elements are collected and inserted in a
+  /// single batch. After that, elements that aren't larger than the current
+  /// minimum are rejected after a single comparison.
+  ///
+  /// - Parameters:
+  ///   - newElements: The elements to insert.
+  ///   - k: The maximum number of items to keep. `k` must be nonnegative.
+  ///
+  /// - Complexity: O(*n* log(`k`)) element comparisons in the worst case,
+  ///    where *n* is the length of `newElements`. If the input is in random
+  ///    order, the expected number of replacements is O(`k` log(*n*/`k`)),
+  ///    so the cost is dominated by the O(*n*) comparisons needed to reject
+  ///    the rest.
+  @inlinable
+  public mutating func insert(
+    contentsOf newElements: some Sequence<Element>,
+    keepingLargest k: Int
+  ) {
+    precondition(k >= 0, "Cannot keep a negative number of items")
+    while count > k { _ = popMin() }
+    let estimate = newElements.underestimatedCount
+    var it = newElements.makeIterator()
+    if count < k {
+      var batch: [Element] = []
+      batch.reserveCapacity(Swift.min(k - count, estimate))
+      while count + batch.count < k {
+        guard let next = it.next() else {
+          insert(contentsOf: batch)
+          return
+        }
+        batch.append(next)
+      }
+      insert(contentsOf: batch)
+    }
+    guard k > 0 else { return }
+    while let next = it.next() {
+      // Early reject: in a long stream, most items don't beat the minimum.
+      guard _storage[0] < next else { continue }
+      replaceMin(with: next)
+    }
+  }
+
+  /// Returns a heap containing the `k` largest elements of the given
+  /// sequence.
+  ///
+  /// The result can be used as a regular heap. For example, to process the
+  /// selected items in descending order, pop them one by one using
+  /// `popMax()`:
+  ///
+  ///     var best = Heap.topK(3, of: [7, 3, 9, 1, 8, 5])
+  ///     while let score = best.popMax() {
+  ///       print(score)  // Prints 9, 8, then 7
+  ///     }
+  ///
+  /// If the sequence contains fewer than `k` elements, then the result
+  /// contains all of them. If there are ties, it is unspecified which of the
+  /// equal items are kept.
+  ///
+  /// - Parameters:
+  ///   - k: The number of items to select. `k` must be nonnegative.
+  ///   - elements: The sequence to select items from.
+  ///
+  /// - Complexity: O(*n* log(`k`)) element comparisons in the worst case,
+  ///    where *n* is the length of `elements`; O(*n* + `k` log(*n*/`k`)
+  ///    log(`k`)) on average if the input is in random order.
+  @inlinable
+  public static func topK(
+    _ k: Int,
+    of elements: some Sequence<Element>
+  ) -> Heap {
+    var result = Heap()
+    result.insert(contentsOf: elements, keepingLargest: k)
+    return result
+  }
+}
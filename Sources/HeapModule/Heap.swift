@@ -323,9 +323,14 @@ extension Heap {
 
   /// Inserts the elements in the given sequence into the heap.
   ///
+  /// Large batches of new elements are appended to the heap's storage in one
+  /// go, then the heap property is restored with a single bottom-up pass
+  /// that only visits the ancestors of the new items.
+  ///
   /// - Parameter newElements: The new elements to insert into the heap.
   ///
-  /// - Complexity: O(`count` + *k*), where *k* is the length of `newElements`.
+  /// - Complexity: O(*k* + log(`count`)^2) comparisons, where *k* is the
+  ///    length of `newElements`.
   @inlinable
   public mutating func insert(
     contentsOf newElements: some Sequence<Element>
@@ -346,23 +351,25 @@ extension Heap {
     }
 
     // Otherwise we can either insert items one by one, or we can run Floyd's
-    // algorithm to re-heapify our entire storage from scratch.
+    // algorithm on the ancestors of the new items to restore heapness in a
+    // single bottom-up pass.
     //
     // If n is the original count, and k is the number of items we need to
-    // append, then Floyd's costs O(n + k) comparisons/swaps, while
-    // the naive loop costs k * log(n + k) -- so we expect that Floyd will
-    // be cheaper whenever k is "large enough" relative to n.
-    //
-    // Floyd's algorithm has a worst-case upper complexity bound of 2 * (n + k),
-    // so one simple heuristic is to use it whenever k * log(n + k) exceeds
-    // that.
+    // append, then the naive loop costs up to k * log(n + k) comparisons and
+    // swaps. The partial heapify visits about k + log(n + k) nodes, but the
+    // cost of sinking each one is proportional to its height in the tree.
+    // Most of the visited nodes are near the bottom, so the total comes to
+    // O(k + log(n + k)^2), which is never worse than Floyd's algorithm on the
+    // entire storage.
     //
-    // FIXME: Write a benchmark to verify this heuristic.
-    let heuristicLimit = 2 * newCount / newCount._binaryLogarithm()
-    let useFloyd = (newCount - origCount) < heuristicLimit
+    // The partial heapify wins whenever k is larger than about log(n + k).
+    // We require k to be at least twice that, because sinking a node costs
+    // more comparisons per level than bubbling one up.
+    let logCount = newCount._binaryLogarithm()
+    let useHeapify = (newCount - origCount) >= 2 * logCount
     _update { handle in
-      if useFloyd {
-        handle.heapify()
+      if useHeapify {
+        handle.heapify(from: origCount)
       } else {
         for offset in origCount ..< handle.count {
           handle.bubbleUp(_HeapNode(offset: offset))
@@ -370,4 +377,37 @@ extension Heap {
       }
     }
   }
+
+  /// Inserts all elements of another heap into this heap.
+  ///
+  /// The items of the smaller heap are inserted into the larger one using
+  /// `insert(contentsOf:)`, so merging in a large batch costs a single
+  /// bottom-up pass over the ancestors of the new items, rather than a
+  /// logarithmic number of comparisons for each of them.
+  ///
+  ///     var timers: Heap = [30, 10, 20]
+  ///     timers.merge([25, 5, 15])
+  ///     print(timers.min)  // 5
+  ///     print(timers.max)  // 30
+  ///
+  /// - Parameter other: The heap whose elements to insert into this heap.
+  ///
+  /// - Complexity: O(*k* + log(*n*)^2) comparisons, where *n* is the count
+  ///    of the merged heap and *k* is the count of the smaller of the two
+  ///    input heaps, plus the cost of copying the smaller heap's storage.
+  @inlinable
+  public mutating func merge(_ other: __owned Heap) {
+    guard !other.isEmpty else { return }
+    guard !self.isEmpty else {
+      self = other
+      return
+    }
+    if other.count > self.count {
+      var result = other
+      result.insert(contentsOf: self._storage)
+      self = result
+    } else {
+      insert(contentsOf: other._storage)
+    }
+  }
 }
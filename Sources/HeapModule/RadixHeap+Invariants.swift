@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+extension RadixHeap {
+  /// True if consistency checking is enabled in the implementation of this
+  /// type, false otherwise.
+  ///
+  /// Documented performance promises are null and void when this property
+  /// returns true -- for example, operations that are documented to take
+  /// O(1) time might take O(*n*) time, or worse.
+  public static var _isConsistencyCheckingEnabled: Bool {
+    _isCollectionsInternalCheckingEnabled
+  }
+
+  #if COLLECTIONS_INTERNAL_CHECKS
+  /// Verifies that every item is in the bucket that matches its key, and
+  /// that the count is in sync with the buckets.
+  @inlinable
+  @inline(never)
+  internal func _checkInvariants() {
+    precondition(_buckets.count == Key.bitWidth + 1, "Wrong number of buckets")
+    var count = 0
+    for i in _buckets.indices {
+      for item in _buckets[i] {
+        precondition(item.key >= _last,
+                     "Key \(item.key) is less than lower bound \(_last)")
+        precondition(Self._bucket(for: item.key, relativeTo: _last) == i,
+                     "Key \(item.key) is in the wrong bucket \(i)")
+      }
+      count += _buckets[i].count
+    }
+    precondition(count == _count, "Count is out of sync")
+  }
+  #else
+  @inlinable
+  @inline(__always)
+  public func _checkInvariants() {}
+  #endif  // COLLECTIONS_INTERNAL_CHECKS
+}
@@ -0,0 +1,242 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A monotone priority queue of values keyed by integers, implemented as a
+/// radix heap.
+///
+/// A radix heap only supports workloads where the keys of removed items never
+/// decrease: every inserted key must be at least as large as the key of the
+/// last item removed. This is the case for many event schedulers (where keys
+/// are timestamps that only move forward), and for Dijkstra's shortest path
+/// algorithm with nonnegative integer edge weights.
+///
+///     var events = RadixHeap<UInt64, String>()
+///     events.insert(key: 30, value: "timeout")
+///     events.insert(key: 10, value: "tick")
+///     let next = events.popMin()     // (key: 10, value: "tick")
+///     events.insert(key: 20, value: "tock")
+///     events.insert(key: 5, value: "oops")  // Error: 5 < 10
+///
+/// In exchange for this restriction, operations are cheaper than in a
+/// general-purpose heap: insertions take constant time, and removals take
+/// amortized O(log(*C*)) time, where *C* is the range of the keys (i.e., at
+/// most `Key.bitWidth`). There are no element comparisons along a tree path;
+/// items are kept in `Key.bitWidth + 1` buckets, based on the highest bit in
+/// which their key differs from the last removed key. When the bucket
+/// holding the current minimum runs dry, the next nonempty bucket is
+/// redistributed into lower buckets. Each item can only move down a bucket
+/// so many times, and each move is a simple append.
+///
+/// Items with equal keys are removed in an unspecified order.
+@frozen
+public struct RadixHeap<Key: FixedWidthInteger, Value> {
+  public typealias Element = (key: Key, value: Value)
+
+  /// The items in the heap. The bucket at index `i > 0` holds items whose key
+  /// differs from `_last` in bit `i - 1`, but not in any higher bit. Bucket
+  /// 0 holds items whose key is equal to `_last`.
+  @usableFromInline
+  internal var _buckets: ContiguousArray<ContiguousArray<Element>>
+
+  /// The key of the last removed item, or `Key.min` if no item has been
+  /// removed yet.
+  @usableFromInline
+  internal var _last: Key
+
+  @usableFromInline
+  internal var _count: Int
+
+  /// Creates an empty heap.
+  @inlinable
+  public init() {
+    _buckets = ContiguousArray(
+      repeating: [], count: Key.bitWidth &+ 1)
+    _last = Key.min
+    _count = 0
+  }
+}
+
+extension RadixHeap: Sendable where Key: Sendable, Value: Sendable {}
+
+extension RadixHeap {
+  /// A Boolean value indicating whether or not the heap is empty.
+  ///
+  /// - Complexity: O(1)
+  @inlinable @inline(__always)
+  public var isEmpty: Bool {
+    _count == 0
+  }
+
+  /// The number of items in the heap.
+  ///
+  /// - Complexity: O(1)
+  @inlinable @inline(__always)
+  public var count: Int {
+    _count
+  }
+
+  /// The smallest key that can be inserted into the heap. This is the key of
+  /// the item most recently removed by `popMin()`, or `Key.min` if nothing
+  /// has been removed yet.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var lowerBound: Key {
+    _last
+  }
+
+  /// Returns the item with the smallest key, if available.
+  ///
+  /// - Complexity: O(1) if the heap contains an item whose key is equal to
+  ///    `lowerBound`; otherwise linear in the number of items in the lowest
+  ///    nonempty bucket.
+  @inlinable
+  public var min: Element? {
+    guard _count > 0 else { return nil }
+    if let item = _buckets[0].last { return item }
+    var i = 1
+    while _buckets[i].isEmpty { i &+= 1 }
+    return _buckets[i].min { $0.key < $1.key }
+  }
+
+  @inlinable @inline(__always)
+  internal static func _bucket(for key: Key, relativeTo last: Key) -> Int {
+    Key.bitWidth &- (key ^ last).leadingZeroBitCount
+  }
+
+  /// Inserts an item with the given key into the heap.
+  ///
+  /// - Parameters:
+  ///   - key: The key of the new item. This must not be less than
+  ///      `lowerBound`.
+  ///   - value: The value associated with the key.
+  ///
+  /// - Complexity: Amortized O(1)
+  @inlinable
+  public mutating func insert(key: Key, value: Value) {
+    precondition(
+      key >= _last, "Key is less than the key of the last removed item")
+    _buckets[Self._bucket(for: key, relativeTo: _last)]
+      .append((key: key, value: value))
+    _count &+= 1
+    _checkInvariants()
+  }
+
+  /// Removes and returns the item with the smallest key, if available.
+  ///
+  /// - Complexity: Amortized O(log(*C*)), where *C* is the range of keys in
+  ///    the heap. This is bounded by `Key.bitWidth`.
+  @inlinable
+  public mutating func popMin() -> Element? {
+    guard _count > 0 else { return nil }
+    if _buckets[0].isEmpty {
+      _redistribute()
+    }
+    _count &-= 1
+    let item = _buckets[0].removeLast()
+    _checkInvariants()
+    return item
+  }
+
+  /// Removes and returns the item with the smallest key.
+  ///
+  /// The heap *must not* be empty.
+  ///
+  /// - Complexity: Amortized O(log(*C*)), where *C* is the range of keys in
+  ///    the heap. This is bounded by `Key.bitWidth`.
+  @inlinable
+  @discardableResult
+  public mutating func removeMin() -> Element {
+    return popMin()!
+  }
+
+  /// Empties the lowest nonempty bucket, making its smallest key the new
+  /// `_last`, and moving each of its items to a lower bucket.
+  ///
+  /// The buckets above it are unaffected: their keys differ from the new
+  /// `_last` in the same highest bit as they did from the old one.
+  @inlinable
+  internal mutating func _redistribute() {
+    assert(_count > 0 && _buckets[0].isEmpty)
+    var i = 1
+    while _buckets[i].isEmpty { i &+= 1 }
+
+    // Take the bucket out, so that we can append to the others while
+    // iterating over it, and put it back empty to keep its capacity.
+    var moving: ContiguousArray<Element> = []
+    swap(&moving, &_buckets[i])
+
+    var last = moving[0].key
+    for item in moving where item.key < last {
+      last = item.key
+    }
+    _last = last
+    for item in moving {
+      _buckets[Self._bucket(for: item.key, relativeTo: last)].append(item)
+    }
+    moving.removeAll(keepingCapacity: true)
+    swap(&moving, &_buckets[i])
+  }
+
+  /// Removes all items from the heap, and resets `lowerBound` to `Key.min`.
+  ///
+  /// - Parameter keepCapacity: If `true`, the heap's buckets keep their
+  ///    allocated storage. The default is `false`.
+  ///
+  /// - Complexity: O(`count`)
+  @inlinable
+  public mutating func removeAll(keepingCapacity keepCapacity: Bool = false) {
+    for i in _buckets.indices {
+      _buckets[i].removeAll(keepingCapacity: keepCapacity)
+    }
+    _last = Key.min
+    _count = 0
+  }
+}
+
+extension RadixHeap {
+  /// Creates a heap from a sequence of key-value pairs.
+  ///
+  /// - Complexity: O(*n*), where *n* is the number of items in `elements`.
+  @inlinable
+  public init(_ elements: some Sequence<Element>) {
+    self.init()
+    insert(contentsOf: elements)
+  }
+
+  /// Inserts the key-value pairs in the given sequence into the heap.
+  ///
+  /// - Parameter newElements: The items to insert. None of their keys may be
+  ///    less than `lowerBound`.
+  ///
+  /// - Complexity: Amortized O(*k*), where *k* is the length of
+  ///    `newElements`.
+  @inlinable
+  public mutating func insert(contentsOf newElements: some Sequence<Element>) {
+    for item in newElements {
+      insert(key: item.key, value: item.value)
+    }
+  }
+}
+
+extension RadixHeap: CustomStringConvertible {
+  /// A textual representation of this instance.
+  public var description: String {
+    "<\(count) item\(count == 1 ? "" : "s")>"
+  }
+}
+
+extension RadixHeap: CustomDebugStringConvertible {
+  /// A textual representation of this instance, suitable for debugging.
+  public var debugDescription: String {
+    description
+  }
+}
@@ -0,0 +1,175 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+/// A node in the tree of a `BlockedHeap`.
+///
+/// The tree is cut into blocks of height `h`, each holding a complete
+/// subtree of `2^h - 1` nodes, stored contiguously in breadth-first order.
+/// Every leaf of a block has two child blocks, so the blocks form a tree of
+/// fan-out `2^h`, and the blocks are themselves laid out in breadth-first
+/// order. For example, with `h == 2`:
+///
+///     block 0: offsets 0 ..< 3  (0 is the root; 1 and 2 are its children)
+///     block 1: offsets 3 ..< 6  (3 is the left child of 1)
+///     block 2: offsets 6 ..< 9  (6 is the right child of 1)
+///     block 3: offsets 9 ..< 12 (9 is the left child of 2)
+///     ...
+///
+/// Unlike `_HeapNode`, the level of a node is its depth in the full tree,
+/// which doesn't follow from its offset alone without knowing `h`.
+@usableFromInline @frozen
+internal struct _BlockedHeapNode {
+  @usableFromInline
+  internal var offset: Int
+
+  @usableFromInline
+  internal var level: Int
+
+  @inlinable @inline(__always)
+  internal init(offset: Int, level: Int) {
+    assert(offset >= 0 && level >= 0)
+    self.offset = offset
+    self.level = level
+  }
+
+  /// Returns the node at the given offset in a tree with the specified block
+  /// height.
+  @inlinable
+  internal init(offset: Int, blockHeight h: Int) {
+    let size = Self.blockSize(h)
+    let block = offset / size
+    let local = offset &- block &* size
+    // There are `2^(h*d)` blocks at depth `d`, preceded by
+    // `(2^(h*d) - 1) / (2^h - 1)` blocks at lower depths.
+    let blockDepth = (block &* size &+ 1)._binaryLogarithm() / h
+    self.init(
+      offset: offset,
+      level: blockDepth &* h &+ (local &+ 1)._binaryLogarithm())
+  }
+}
+
+extension _BlockedHeapNode: Equatable {
+  @inlinable @inline(__always)
+  internal static func ==(left: Self, right: Self) -> Bool {
+    left.offset == right.offset
+  }
+}
+
+extension _BlockedHeapNode: CustomStringConvertible {
+  @usableFromInline
+  internal var description: String {
+    "(offset: \(offset), level: \(level))"
+  }
+}
+
+extension _BlockedHeapNode {
+  /// The root node in the heap.
+  @inlinable @inline(__always)
+  internal static var root: Self {
+    Self(offset: 0, level: 0)
+  }
+
+  /// The first max node in the heap. (I.e., the left child of the root.)
+  ///
+  /// Block heights are always at least 2, so this is in the first block.
+  @inlinable @inline(__always)
+  internal static var leftMax: Self {
+    Self(offset: 1, level: 1)
+  }
+
+  /// The second max node in the heap. (I.e., the right child of the root.)
+  @inlinable @inline(__always)
+  internal static var rightMax: Self {
+    Self(offset: 2, level: 1)
+  }
+
+  @inlinable @inline(__always)
+  internal var isMinLevel: Bool {
+    level & 0b1 == 0
+  }
+
+  @inlinable @inline(__always)
+  internal var isRoot: Bool {
+    offset == 0
+  }
+
+  /// The number of nodes in a block of the given height.
+  @inlinable @inline(__always)
+  internal static func blockSize(_ h: Int) -> Int {
+    (1 &<< h) &- 1
+  }
+}
+
+extension _BlockedHeapNode {
+  /// Returns the left child of this node in a tree of the given block
+  /// height. The result may not exist in the heap.
+  @inlinable @inline(__always)
+  internal func leftChild(blockHeight h: Int) -> Self {
+    _child(blockHeight: h, right: false)
+  }
+
+  /// Returns the right child of this node in a tree of the given block
+  /// height. The result may not exist in the heap.
+  @inlinable @inline(__always)
+  internal func rightChild(blockHeight h: Int) -> Self {
+    _child(blockHeight: h, right: true)
+  }
+
+  @inlinable @inline(__always)
+  internal func _child(blockHeight h: Int, right: Bool) -> Self {
+    let size = Self.blockSize(h)
+    let block = offset / size
+    let local = offset &- block &* size
+    let firstLeaf = (1 &<< (h &- 1)) &- 1
+    let delta = right ? 1 : 0
+    if local < firstLeaf {
+      // Local child `2 * local + 1 + delta` within the same block.
+      return Self(offset: offset &+ local &+ 1 &+ delta, level: level &+ 1)
+    }
+    // The root of a child block.
+    let childBlock = (block &<< h) &+ 1 &+ 2 &* (local &- firstLeaf) &+ delta
+    return Self(offset: childBlock &* size, level: level &+ 1)
+  }
+
+  /// Returns the parent of this node in a tree of the given block height.
+  /// This node must not be the root.
+  @inlinable @inline(__always)
+  internal func parent(blockHeight h: Int) -> Self {
+    assert(!isRoot)
+    let size = Self.blockSize(h)
+    let block = offset / size
+    let local = offset &- block &* size
+    if local > 0 {
+      return Self(
+        offset: offset &- local &+ ((local &- 1) &>> 1),
+        level: level &- 1)
+    }
+    // This is the root of a block; its parent is a leaf of the parent block.
+    let parentBlock = (block &- 1) &>> h
+    let leaf = ((block &- 1) & size) &>> 1
+    let firstLeaf = (1 &<< (h &- 1)) &- 1
+    return Self(
+      offset: parentBlock &* size &+ firstLeaf &+ leaf,
+      level: level &- 1)
+  }
+
+  /// Returns the grandparent of this node in a tree of the given block
+  /// height, or nil if this node is in one of the top two levels.
+  @inlinable @inline(__always)
+  internal func grandParent(blockHeight h: Int) -> Self? {
+    guard level >= 2 else { return nil }
+    return parent(blockHeight: h).parent(blockHeight: h)
+  }
+}
@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+
+// #############################################################################
+// #                                                                           #
+// #            DO NOT EDIT THIS FILE; IT IS AUTOGENERATED.                    #
+// #                                                                           #
+// #############################################################################
+
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#elseif canImport(Android)
+import Android
+#elseif os(Windows)
+import WinSDK
+#endif
+
+
+// In single module mode, we need these declarations to be internal,
+// but in regular builds we want them to be public. Unfortunately
+// the current best way to do this is to duplicate all definitions.
+#if COLLECTIONS_SINGLE_MODULE
+/// A block of unused memory that is large enough to push the stored
+/// properties that follow it onto a separate cache line, to prevent false
+/// sharing between variables that are written by different threads.
+///
+/// We use 128 bytes rather than the more common 64, as some processors fetch
+/// cache lines in adjacent pairs.
+@frozen @usableFromInline
+internal struct _CacheLinePadding {
+  @usableFromInline
+  internal var _bytes: (
+    UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64,
+    UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64)
+
+  @inlinable
+  internal init() {
+    _bytes = (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+  }
+}
+
+/// Relinquish the processor, letting other threads run.
+@usableFromInline
+internal func _yieldThread() {
+  #if os(Windows)
+  _ = SwitchToThread()
+  #elseif canImport(Darwin) || canImport(Glibc) || canImport(Musl) || canImport(Android)
+  _ = sched_yield()
+  #endif
+}
+#else // !COLLECTIONS_SINGLE_MODULE
+/// A block of unused memory that is large enough to push the stored
+/// properties that follow it onto a separate cache line, to prevent false
+/// sharing between variables that are written by different threads.
+///
+/// We use 128 bytes rather than the more common 64, as some processors fetch
+/// cache lines in adjacent pairs.
+@frozen
+public struct _CacheLinePadding {
+  @usableFromInline
+  internal var _bytes: (
+    UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64,
+    UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64)
+
+  @inlinable
+  public init() {
+    _bytes = (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+  }
+}
+
+/// Relinquish the processor, letting other threads run.
+
+public func _yieldThread() {
+  #if os(Windows)
+  _ = SwitchToThread()
+  #elseif canImport(Darwin) || canImport(Glibc) || canImport(Musl) || canImport(Android)
+  _ = sched_yield()
+  #endif
+}
+#endif // COLLECTIONS_SINGLE_MODULE
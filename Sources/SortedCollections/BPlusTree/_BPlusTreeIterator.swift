@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// An iterator over the slots of the leaves of a B+ tree, in ascending order
+/// of their keys.
+@usableFromInline
+@frozen
+internal struct _BPlusTreeIterator<Node: _BPlusTreeNode> {
+  /// The nodes along the path to the current leaf, along with the slot of
+  /// the next child or key-value pair to visit in each.
+  @usableFromInline
+  internal var _path: [(node: Node, slot: Int)]
+
+  @inlinable
+  internal init(root: Node) {
+    self._path = [(root, 0)]
+  }
+
+  /// Advances to the next key-value pair and returns the leaf and slot
+  /// holding it, or `nil` if no next key-value pair exists.
+  ///
+  /// - Complexity: O(1) amortized.
+  @inlinable
+  internal mutating func next() -> (leaf: Node, slot: Int)? {
+    while let top = _path.last {
+      let node = top.node
+      let slot = top.slot
+      if node.isLeaf {
+        if slot < node.count {
+          _path[_path.count &- 1].slot = slot &+ 1
+          return (node, slot)
+        }
+      } else if slot < node.children.count {
+        _path[_path.count &- 1].slot = slot &+ 1
+        _path.append((node.children[slot], 0))
+        continue
+      }
+      _path.removeLast()
+    }
+    return nil
+  }
+}
@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if COLLECTIONS_INTERNAL_CHECKS
+extension _BPlusTreeNode {
+  /// Verifies the structure of the subtree rooted at this node.
+  ///
+  /// The ordering of keys depends on how leaves store them, so it is left to
+  /// `checkLeaf`, which is called with every leaf and the separators that
+  /// bound its keys: every key must be greater than or equal to the lower
+  /// bound, and less than the upper bound.
+  ///
+  /// - Returns: The depth of the subtree and the number of key-value pairs in
+  ///     it.
+  @inline(never)
+  @discardableResult
+  internal func _checkInvariants(
+    isRoot: Bool,
+    lowerBound: Separator? = nil,
+    upperBound: Separator? = nil,
+    checkLeaf: (Self, _ lowerBound: Separator?, _ upperBound: Separator?) -> Void
+  ) -> (depth: Int, count: Int) {
+    precondition(isRoot || !isUnderfull, "Unbalanced node.")
+    precondition(slotCount <= capacity, "Node over capacity.")
+
+    if isLeaf {
+      precondition(values.count == count,
+                   "Value count should match the count of leaves.")
+      precondition(children.isEmpty && separators.isEmpty,
+                   "Leaf with children.")
+      checkLeaf(self, lowerBound, upperBound)
+      return (0, count)
+    }
+
+    precondition(values.isEmpty, "Internal node with values.")
+    precondition(separators.count == children.count - 1,
+                 "Separator and child counts don't match for internal nodes.")
+    precondition(!isRoot || children.count > 1,
+                 "Internal root with a single child.")
+    var depth: Int? = nil
+    var count = 0
+    for slot in children.indices {
+      let result = children[slot]._checkInvariants(
+        isRoot: false,
+        lowerBound: slot > 0 ? separators[slot - 1] : lowerBound,
+        upperBound: slot < separators.count ? separators[slot] : upperBound,
+        checkLeaf: checkLeaf)
+      precondition(depth == nil || depth == result.depth,
+                   "Leaves at different depths.")
+      depth = result.depth
+      count += result.count
+    }
+    precondition(self.count == count, "Invalid subtree count.")
+    return (depth! + 1, count)
+  }
+}
+#endif // COLLECTIONS_INTERNAL_CHECKS
@@ -0,0 +1,316 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A node of a B+ tree that stores its contents in arrays.
+///
+/// Key-value pairs are only stored in leaves. Internal nodes hold their
+/// children, along with separators to route lookups: every key in
+/// `children[i]` is less than `separators[i]`, and every key in
+/// `children[i + 1]` is greater than or equal to it. Every node caches the
+/// number of key-value pairs beneath it.
+///
+/// Conforming types decide how leaves store their keys, and what separators
+/// look like. The tree algorithms are implemented on top of these in
+/// extensions of this protocol.
+///
+/// Nodes are shared between copies of a tree, so they must be made unique
+/// with ``_makeUnique(_:)`` before they are mutated.
+@usableFromInline
+internal protocol _BPlusTreeNode: AnyObject {
+  /// The type of the values in the tree.
+  associatedtype Value
+
+  /// The representation of a key that lookups take.
+  associatedtype SearchKey
+
+  /// The type of the keys that separate the children of internal nodes.
+  associatedtype Separator
+
+  /// The maximum number of key-value pairs in a leaf.
+  static var leafCapacity: Int { get }
+
+  /// The maximum number of children of an internal node.
+  static var internalCapacity: Int { get }
+
+  var isLeaf: Bool { get }
+
+  /// The number of key-value pairs in this subtree.
+  var count: Int { get set }
+
+  /// The values of a leaf. Always empty for internal nodes.
+  var values: ContiguousArray<Value> { get set }
+
+  /// The keys separating the children of an internal node. Always empty for
+  /// leaves.
+  var separators: ContiguousArray<Separator> { get set }
+
+  /// The children of an internal node. Always empty for leaves.
+  var children: ContiguousArray<Self> { get set }
+
+  /// Creates an internal node with the given children and separators.
+  init(children: ContiguousArray<Self>, separators: ContiguousArray<Separator>)
+
+  /// Returns a copy of this node that shares its children with it.
+  func copy() -> Self
+
+  /// Finds the first slot of a leaf whose key is greater than or equal to
+  /// the given one.
+  ///
+  /// - Returns: The slot, and whether the key in it equals `key`.
+  func _leafSlot(forKey key: SearchKey) -> (slot: Int, isFound: Bool)
+
+  /// Returns the slot of the child of an internal node that would contain
+  /// `key`.
+  func _childSlot(forKey key: SearchKey) -> Int
+
+  /// Inserts a key-value pair into the given slot of a leaf.
+  ///
+  /// - Warning: This does not update the count of the node.
+  func _insert(_ value: __owned Value, forKey key: SearchKey, atSlot slot: Int)
+
+  /// Removes the key-value pair in the given slot of a leaf.
+  ///
+  /// - Warning: This does not update the count of the node.
+  func _remove(atSlot slot: Int) -> Value
+
+  /// Appends the key-value pairs of another leaf, whose keys must all be
+  /// greater than the keys of this one.
+  ///
+  /// - Warning: This does not update the count of the node.
+  func _appendLeaf(_ other: Self)
+
+  /// Moves the key-value pairs of a leaf from the given slot onwards into a
+  /// new leaf, and returns it along with the separator between the two.
+  ///
+  /// - Warning: This does not update the count of the current node.
+  func _splitLeaf(at slot: Int) -> (separator: Separator, node: Self)
+
+  /// Updates any data cached in this node after its contents have changed,
+  /// other than its count. The children of the node are already up to date.
+  func _didUpdate()
+}
+
+extension _BPlusTreeNode {
+  @inlinable
+  @inline(__always)
+  internal var capacity: Int {
+    isLeaf ? Self.leafCapacity : Self.internalCapacity
+  }
+
+  /// The number of key-value pairs in a leaf, or children of an internal
+  /// node.
+  @inlinable
+  @inline(__always)
+  internal var slotCount: Int {
+    isLeaf ? count : children.count
+  }
+
+  /// Whether the node has too few slots to be anything but the root.
+  @inlinable
+  @inline(__always)
+  internal var isUnderfull: Bool {
+    slotCount < capacity / 2
+  }
+
+  /// Returns the leaf that would contain `key` in the subtree.
+  @inlinable
+  internal func _leaf(forKey key: SearchKey) -> Self {
+    var node = self
+    while !node.isLeaf {
+      node = node.children[node._childSlot(forKey: key)]
+    }
+    return node
+  }
+
+  /// Returns the value associated with `key` in the subtree, if any.
+  @inlinable
+  internal func _value(forKey key: SearchKey) -> Value? {
+    let leaf = _leaf(forKey: key)
+    let (slot, isFound) = leaf._leafSlot(forKey: key)
+    return isFound ? leaf.values[slot] : nil
+  }
+
+  /// Moves the upper half of this node into a new node, and returns it along
+  /// with the separator between the two.
+  ///
+  /// - Warning: This does not call `_didUpdate()` on the current node.
+  @inlinable
+  internal func _split() -> (separator: Separator, node: Self) {
+    let mid = slotCount / 2
+    let splinter: (separator: Separator, node: Self)
+    if isLeaf {
+      splinter = _splitLeaf(at: mid)
+    } else {
+      let right = Self(
+        children: ContiguousArray(children[mid...]),
+        separators: ContiguousArray(separators[mid...]))
+      splinter = (separators[mid &- 1], right)
+      children.removeSubrange(mid...)
+      separators.removeSubrange((mid &- 1)...)
+    }
+    count -= splinter.node.count
+    return splinter
+  }
+}
+
+// MARK: Mutations
+extension _BPlusTreeNode {
+  @inlinable
+  @inline(__always)
+  internal static func _makeUnique(_ node: inout Self) {
+    if !isKnownUniquelyReferenced(&node) {
+      node = node.copy()
+    }
+  }
+
+  /// Inserts a key-value pair into the subtree, or updates the value of an
+  /// existing key.
+  ///
+  /// - Returns: The previous value of the key, if any, and a new right
+  ///     sibling for `node` if it had to be split.
+  @inlinable
+  internal static func _updateValue(
+    _ value: __owned Value,
+    forKey key: SearchKey,
+    in node: inout Self
+  ) -> (old: Value?, splinter: (separator: Separator, node: Self)?) {
+    _makeUnique(&node)
+
+    if node.isLeaf {
+      let (slot, isFound) = node._leafSlot(forKey: key)
+      if isFound {
+        let old = node.values[slot]
+        node.values[slot] = value
+        node._didUpdate()
+        return (old, nil)
+      }
+      node._insert(value, forKey: key, atSlot: slot)
+    } else {
+      let slot = node._childSlot(forKey: key)
+      let result = _updateValue(value, forKey: key, in: &node.children[slot])
+      if result.old != nil {
+        node._didUpdate()
+        return (result.old, nil)
+      }
+      if let splinter = result.splinter {
+        node.children.insert(splinter.node, at: slot &+ 1)
+        node.separators.insert(splinter.separator, at: slot)
+      }
+    }
+
+    node.count += 1
+    let splinter = node.slotCount > node.capacity ? node._split() : nil
+    node._didUpdate()
+    return (nil, splinter)
+  }
+
+  /// Inserts a key-value pair into the tree with the given root, or updates
+  /// the value of an existing key, growing the tree if the root splits.
+  ///
+  /// - Returns: The previous value of the key, if any.
+  @inlinable
+  internal static func _updateValue(
+    _ value: __owned Value,
+    forKey key: SearchKey,
+    inRoot root: inout Self
+  ) -> Value? {
+    let (old, splinter) = _updateValue(value, forKey: key, in: &root)
+    if let splinter = splinter {
+      root = Self(
+        children: [root, splinter.node],
+        separators: [splinter.separator])
+    }
+    return old
+  }
+
+  /// Removes the key-value pair with the given key from the subtree, if it
+  /// exists.
+  ///
+  /// This may leave `node` underfull; its parent is responsible for
+  /// rebalancing it.
+  ///
+  /// - Returns: The value of the removed key-value pair, if any.
+  @inlinable
+  internal static func _removeValue(
+    forKey key: SearchKey,
+    in node: inout Self
+  ) -> Value? {
+    _makeUnique(&node)
+
+    let removed: Value
+    if node.isLeaf {
+      let (slot, isFound) = node._leafSlot(forKey: key)
+      guard isFound else { return nil }
+      removed = node._remove(atSlot: slot)
+    } else {
+      let slot = node._childSlot(forKey: key)
+      guard let value = _removeValue(forKey: key, in: &node.children[slot])
+      else { return nil }
+      removed = value
+      if node.children[slot].isUnderfull {
+        node._rebalanceChild(atSlot: slot)
+      }
+    }
+
+    node.count -= 1
+    node._didUpdate()
+    return removed
+  }
+
+  /// Removes the key-value pair with the given key from the tree with the
+  /// given root, if it exists, shrinking the tree if the root is left with
+  /// a single child.
+  ///
+  /// - Returns: The value of the removed key-value pair, if any.
+  @inlinable
+  internal static func _removeValue(
+    forKey key: SearchKey,
+    inRoot root: inout Self
+  ) -> Value? {
+    let removed = _removeValue(forKey: key, in: &root)
+    if !root.isLeaf && root.children.count == 1 {
+      root = root.children[0]
+    }
+    return removed
+  }
+
+  /// Merges an underfull child with one of its siblings, splitting the
+  /// result evenly if it doesn't fit in a single node.
+  ///
+  /// - Warning: This does not call `_didUpdate()` on the current node.
+  @inlinable
+  internal func _rebalanceChild(atSlot slot: Int) {
+    guard children.count > 1 else { return }
+    let leftSlot = slot > 0 ? slot &- 1 : slot
+
+    // The right node is only read from, so it doesn't need to be unique.
+    let right = children.remove(at: leftSlot &+ 1)
+    let separator = separators.remove(at: leftSlot)
+
+    Self._makeUnique(&children[leftSlot])
+    let left = children[leftSlot]
+    if left.isLeaf {
+      left._appendLeaf(right)
+    } else {
+      left.separators.append(separator)
+      left.separators.append(contentsOf: right.separators)
+      left.children.append(contentsOf: right.children)
+    }
+    left.count += right.count
+
+    if left.slotCount > left.capacity {
+      let splinter = left._split()
+      children.insert(splinter.node, at: leftSlot &+ 1)
+      separators.insert(splinter.separator, at: leftSlot)
+    }
+    left._didUpdate()
+  }
+}
@@ -0,0 +1,139 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension _BTree {
+  /// A search finger that resumes each lookup from the position of the
+  /// previous one, for looking up keys in ascending order.
+  ///
+  /// Instead of descending from the root for every key, a finger only climbs
+  /// up the path to the previous key until it reaches a subtree that could
+  /// contain the new key, and then gallops forward within each node on its way
+  /// back down. Looking up a sorted batch of `m` keys this way takes
+  /// O(`m log(n/m)`) comparisons, and mostly touches nodes that are already
+  /// cached.
+  ///
+  /// - Warning: Keys must be looked up in ascending order.
+  /// - Warning: The tree must remain alive and unmodified for the entire
+  ///     lifetime of the finger, as it does not retain its nodes.
+  @usableFromInline
+  internal struct UnsafeFinger {
+    /// A node on the path to the previous key, along with the slot the
+    /// search stopped at within it, and the level of the closest ancestor
+    /// that bounds the keys within the node (or -1 if no ancestor does).
+    @usableFromInline
+    internal typealias Level = (
+      node: Unmanaged<Node.Storage>,
+      slot: Int,
+      boundingLevel: Int8
+    )
+
+    /// The nodes on the path to the previous key, from top to bottom.
+    @usableFromInline
+    internal var path: _FixedSizeArray<Level>
+
+    @inlinable
+    internal init(_ tree: _BTree) {
+      let root: Level = (.passUnretained(tree.root.storage), 0, -1)
+      self.path = _FixedSizeArray(repeating: root)
+      self.path.append(root)
+    }
+
+    /// Returns the value corresponding to the first found instance of the
+    /// key, which must be greater than or equal to the previous key looked up
+    /// with this finger.
+    ///
+    /// - Parameter key: The key to search for.
+    /// - Returns: `nil` if the key was not found. Otherwise, its value.
+    /// - Complexity: O(`log d`), where `d` is the number of elements between
+    ///   the previous key and `key`.
+    @inlinable
+    internal mutating func findAnyValue(forKey key: Key) -> Value? {
+      // Climb until the key falls before the upper bound of the subtree.
+      var level = path.depth &- 1
+      while level > 0 {
+        let boundingLevel = path[level].boundingLevel
+        if boundingLevel < 0 { break }
+
+        let bound = path[boundingLevel]
+        let isPastBound = bound.node._withUnsafeGuaranteedRef { storage in
+          storage.read { handle in key >= handle[keyAt: bound.slot] }
+        }
+        if !isPastBound { break }
+        level = boundingLevel
+      }
+      path.depth = level &+ 1
+
+      while true {
+        let current = path[level]
+        var child: Unmanaged<Node.Storage>? = nil
+        var isChildBounded = false
+
+        let value: Value? = current.node._withUnsafeGuaranteedRef { storage in
+          storage.read { handle in
+            let slot = handle.startSlot(forKey: key, from: current.slot)
+            path[level].slot = slot
+
+            if slot < handle.elementCount && handle[keyAt: slot] == key {
+              return handle[valueAt: slot]
+            }
+
+            if !handle.isLeaf {
+              child = .passUnretained(handle[childAt: slot].storage)
+              isChildBounded = slot < handle.elementCount
+            }
+            return nil
+          }
+        }
+
+        if let value = value { return value }
+        guard let child = child else { return nil }
+
+        path.append((
+          node: child,
+          slot: 0,
+          boundingLevel: isChildBounded ? level : current.boundingLevel
+        ))
+        level &+= 1
+      }
+    }
+  }
+
+  /// Returns the values corresponding to a sequence of keys in ascending
+  /// order, using a search finger to avoid descending from the root for every
+  /// key.
+  ///
+  /// - Parameter keys: The keys to search for, in ascending order.
+  /// - Returns: The value of the first found instance of each key, or `nil` if
+  ///     the key is not in the tree.
+  /// - Complexity: O(`m log(n/m)`) where `m` is the number of keys and `n`
+  ///   the number of elements in the tree.
+  @inlinable
+  internal func findAnyValues<S: Sequence>(
+    forSortedKeys keys: S
+  ) -> [Value?] where S.Element == Key {
+    var result: [Value?] = []
+    result.reserveCapacity(keys.underestimatedCount)
+
+    withExtendedLifetime(self) {
+      var finger = UnsafeFinger(self)
+      var previous: Key? = nil
+      for key in keys {
+        if let previous = previous {
+          precondition(previous <= key, "Keys must be in ascending order")
+        }
+        result.append(finger.findAnyValue(forKey: key))
+        previous = key
+      }
+    }
+
+    return result
+  }
+}
@@ -16,7 +16,8 @@ extension _BTree {
   fileprivate func checkInvariants(
     for node: Node,
     expectedDepth: Int,
-    isRoot: Bool = false
+    isRoot: Bool = false,
+    isRightEdge: Bool = false
   ) -> (
     minimum: Key?,
     maximum: Key?
@@ -36,7 +37,8 @@ extension _BTree {
         assert(handle.elementCount == handle.subtreeCount,
                "Element and subtree count should match for leaves.")
         assert(handle.depth == 0, "Non-zero depth for leaf.")
-        assert(isRoot || handle.isBalanced, "Unbalanced node.")
+        // Only the last leaf may be left underfull by appends.
+        assert(isRoot || isRightEdge || handle.isBalanced, "Unbalanced node.")
         
         if handle.elementCount > 0 {
           return (
@@ -57,7 +59,8 @@ extension _BTree {
             maximum
           ) = checkInvariants(
             for: handle[childAt: i],
-            expectedDepth: expectedDepth - 1
+            expectedDepth: expectedDepth - 1,
+            isRightEdge: isRightEdge && i == handle.childCount - 1
           )
           
           if i == 0 { subtreeMinimum = minimum }
@@ -91,7 +94,8 @@ extension _BTree {
     checkInvariants(
       for: root,
       expectedDepth: root.storage.header.depth,
-      isRoot: true
+      isRoot: true,
+      isRightEdge: true
     )
   }
   #else
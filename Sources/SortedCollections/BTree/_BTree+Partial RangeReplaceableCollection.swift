@@ -19,7 +19,10 @@ extension _BTree {
   public func filter(
     _ isIncluded: (Element) throws -> Bool
   ) rethrows -> _BTree {
-    var builder = Builder()
+    var builder = Builder(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity
+    )
     for element in self where try isIncluded(element) {
       builder.append(element)
     }
@@ -121,21 +124,29 @@ extension _BTree {
   internal mutating func removeAll() {
     invalidateIndices()
     // TODO: potentially use empty storage class.
-    self.root = _Node(withCapacity: _BTree.defaultLeafCapacity, isLeaf: true)
+    self.root = _Node(withCapacity: leafCapacity, isLeaf: true)
   }
   
   /// Removes the elements in the specified subrange from the collection.
+  ///
+  /// This detaches the elements by splitting the tree at the keys at both
+  /// bounds, so the tree must not contain duplicate keys.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of elements in the tree.
   @inlinable
   internal mutating func removeSubrange(_ bounds: Range<Index>) {
-    guard bounds.lowerBound != endIndex else { preconditionFailure("Index out of bounds.") }
-    guard bounds.upperBound != endIndex else { preconditionFailure("Index out of bounds.") }
-    
-    let rangeSize = self.distance(from: bounds.lowerBound, to: bounds.upperBound)
-    let startOffset = bounds.lowerBound.offset
-    
-    for _ in 0..<rangeSize {
-      self.remove(atOffset: startOffset)
+    if bounds.isEmpty {
+      invalidateIndices()
+      return
     }
+    
+    let lowerKey = self[bounds.lowerBound].key
+    let upperKey = bounds.upperBound == endIndex
+      ? nil : self[bounds.upperBound].key
+    self.extractElements(
+      from: (key: lowerKey, isInclusive: true),
+      to: upperKey.map { (key: $0, isInclusive: false) }
+    )
   }
 
 }
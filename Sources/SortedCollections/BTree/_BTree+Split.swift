@@ -0,0 +1,159 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension _BTree {
+  /// Splits the tree into a tree of the elements with keys less than `key`,
+  /// and a tree of the remaining elements.
+  ///
+  /// Both trees share all nodes that don't lie on the path to `key` with this
+  /// tree, and use the same node capacities.
+  ///
+  /// - Parameters:
+  ///   - key: The key to split at.
+  ///   - lowerIncludesKey: Whether elements with keys equal to `key` go into
+  ///       the lower tree rather than the upper one.
+  /// - Returns: The elements before `key`, and the elements after it.
+  /// - Complexity: O(`log n`) where `n` is the number of elements in the tree.
+  @inlinable
+  internal func split(
+    atKey key: Key,
+    lowerIncludesKey: Bool = false
+  ) -> (lower: _BTree, upper: _BTree) {
+    let (lower, upper) = Node.split(
+      root,
+      atKey: key,
+      lowerIncludesKey: lowerIncludesKey,
+      capacity: internalCapacity
+    )
+
+    let lowerTree = _BTree(
+      rootedAt: lower,
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity
+    )
+    let upperTree = _BTree(
+      rootedAt: upper,
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity
+    )
+    lowerTree.checkInvariants()
+    upperTree.checkInvariants()
+    return (lowerTree, upperTree)
+  }
+
+  /// Appends the elements of another tree, all of which must be greater than
+  /// or equal to the elements of this tree.
+  ///
+  /// If both trees use the same node capacities, the root of the shorter tree
+  /// is grafted onto the edge of the taller one, which shares all of its other
+  /// nodes with `other`. Otherwise, both trees are rebuilt into a new one.
+  ///
+  /// - Parameter other: The tree to append.
+  /// - Complexity: O(`log n + log m`) where `n` and `m` are the number of
+  ///   elements in the two trees if their node capacities match, otherwise
+  ///   O(`n + m`).
+  @inlinable
+  internal mutating func append(contentsOf other: __owned _BTree) {
+    invalidateIndices()
+    defer { self.checkInvariants() }
+
+    if other.count == 0 { return }
+
+    guard
+      self.leafCapacity == other.leafCapacity,
+      self.internalCapacity == other.internalCapacity
+    else {
+      var builder = Builder(
+        leafCapacity: leafCapacity,
+        internalCapacity: internalCapacity
+      )
+      for element in self {
+        builder.append(element)
+      }
+      for element in other {
+        builder.append(element)
+      }
+      self.root = builder.finish().root
+      return
+    }
+
+    // The last leaf is about to get a right sibling.
+    self._balanceRightEdge()
+    
+    var other = other
+    let separator = other.popFirst().unsafelyUnwrapped
+    self.root = Node.join(
+      &self.root,
+      with: &other.root,
+      separatedBy: separator,
+      capacity: internalCapacity
+    )
+  }
+}
+
+// MARK: Range Extraction
+extension _BTree {
+  /// A bound of a range of keys.
+  @usableFromInline
+  internal typealias KeyBound = (key: Key, isInclusive: Bool)
+
+  /// Removes the elements with keys within the given bounds, and returns them
+  /// as a new tree.
+  ///
+  /// The tree is split at both bounds, and the pieces outside the range are
+  /// then joined back together. Subtrees that lie entirely within (or
+  /// entirely outside) the range are moved as a whole rather than element by
+  /// element, so only the nodes along the two boundary paths get rebuilt.
+  ///
+  /// - Parameters:
+  ///   - lowerBound: The lower bound of the keys to extract, or `nil` to
+  ///       extract from the start of the tree.
+  ///   - upperBound: The upper bound of the keys to extract, or `nil` to
+  ///       extract through the end of the tree.
+  /// - Returns: A tree with the same node capacities as this one, holding the
+  ///     extracted elements.
+  /// - Complexity: O(`log n`) where `n` is the number of elements in the tree.
+  @inlinable
+  @discardableResult
+  internal mutating func extractElements(
+    from lowerBound: KeyBound?,
+    to upperBound: KeyBound?
+  ) -> _BTree {
+    defer { self.checkInvariants() }
+
+    var remaining = _BTree(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity
+    )
+    var extracted = self
+    if let lowerBound = lowerBound {
+      let (lower, upper) = extracted.split(
+        atKey: lowerBound.key,
+        lowerIncludesKey: !lowerBound.isInclusive
+      )
+      remaining = lower
+      extracted = upper
+    }
+
+    if let upperBound = upperBound {
+      let (lower, upper) = extracted.split(
+        atKey: upperBound.key,
+        lowerIncludesKey: upperBound.isInclusive
+      )
+      remaining.append(contentsOf: upper)
+      extracted = lower
+    }
+
+    self.root = remaining.root
+    self.invalidateIndices()
+    return extracted
+  }
+}
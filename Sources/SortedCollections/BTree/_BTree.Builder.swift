@@ -353,7 +353,11 @@ extension _BTree {
         )
       }
       
-      let tree = _BTree(rootedAt: root, internalCapacity: internalCapacity)
+      let tree = _BTree(
+        rootedAt: root,
+        leafCapacity: leafCapacity,
+        internalCapacity: internalCapacity
+      )
       tree.checkInvariants()
       return tree
     }
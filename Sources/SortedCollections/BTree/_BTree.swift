@@ -63,6 +63,11 @@ internal struct _BTree<Key: Comparable, Value> {
   @usableFromInline
   internal var internalCapacity: Int
   
+  /// The capacity of new leaf nodes that aren't split off an existing leaf,
+  /// e.g. the root of an emptied tree.
+  @usableFromInline
+  internal var leafCapacity: Int
+  
   /// A metric to uniquely identify a given B-Tree's state. It is not
   /// impossible for two B-Trees to have the same age by pure
   /// coincidence.
@@ -77,6 +82,7 @@ internal struct _BTree<Key: Comparable, Value> {
   internal static var dummy: _BTree {
     _BTree(
       _rootedAtNode: _Node.dummy,
+      leafCapacity: 0,
       internalCapacity: 0,
       version: 0
     )
@@ -86,8 +92,10 @@ internal struct _BTree<Key: Comparable, Value> {
   @inlinable
   @inline(__always)
   internal init() {
-    let root = Node(withCapacity: _BTree.defaultLeafCapacity, isLeaf: true)
-    self.init(rootedAt: root, internalCapacity: _BTree.defaultInternalCapacity)
+    self.init(
+      leafCapacity: _BTree.defaultLeafCapacity,
+      internalCapacity: _BTree.defaultInternalCapacity
+    )
   }
   
   /// Creates an empty B-Tree rooted at a specific node with a specified uniform capacity
@@ -111,18 +119,36 @@ internal struct _BTree<Key: Comparable, Value> {
   internal init(leafCapacity: Int, internalCapacity: Int) {
     self.init(
       rootedAt: Node(withCapacity: leafCapacity, isLeaf: true),
+      leafCapacity: leafCapacity,
       internalCapacity: internalCapacity
     )
   }
   
-  /// Creates a B-Tree rooted at a specific node
+  /// Creates a B-Tree rooted at a specific node, using the default capacity
+  /// for new leaf nodes.
   /// - Parameters:
   ///   - root: The root node.
   ///   - internalCapacity: The key capacity of new internal nodes.
   @inlinable
   @inline(__always)
   internal init(rootedAt root: Node, internalCapacity: Int) {
+    self.init(
+      rootedAt: root,
+      leafCapacity: _BTree.defaultLeafCapacity,
+      internalCapacity: internalCapacity
+    )
+  }
+  
+  /// Creates a B-Tree rooted at a specific node
+  /// - Parameters:
+  ///   - root: The root node.
+  ///   - leafCapacity: The key capacity of new leaf nodes.
+  ///   - internalCapacity: The key capacity of new internal nodes.
+  @inlinable
+  @inline(__always)
+  internal init(rootedAt root: Node, leafCapacity: Int, internalCapacity: Int) {
     self.root = root
+    self.leafCapacity = leafCapacity
     self.internalCapacity = internalCapacity
     self.version = ObjectIdentifier(root.storage).hashValue
   }
@@ -131,13 +157,46 @@ internal struct _BTree<Key: Comparable, Value> {
   @inline(__always)
   internal init(
     _rootedAtNode root: Node,
+    leafCapacity: Int,
     internalCapacity: Int,
     version: Int
   ) {
     self.root = root
+    self.leafCapacity = leafCapacity
     self.internalCapacity = internalCapacity
     self.version = version
   }
+  
+  /// The range of node capacities that can be requested through the public
+  /// initializers of the sorted collections.
+  ///
+  /// Slots within a node are stored as `Slot`s, which bounds the capacity
+  /// from above.
+  ///
+  /// Indices and cursors store the path to an element in a
+  /// `_FixedSizeArray`, so trees can be at most 16 levels deep, and growing
+  /// a tree beyond that traps. As nodes other than the root are at least
+  /// about half full, that is far more elements than fit in memory for
+  /// internal capacities of 16 or more, but an internal capacity of 4 limits
+  /// a tree to tens of millions of elements.
+  @inlinable
+  @inline(__always)
+  internal static var validCapacities: ClosedRange<Int> {
+    4 ... Int(Slot.max) - 1
+  }
+  
+  /// Verifies that the given node capacities are supported.
+  @inlinable
+  @inline(__always)
+  internal static func _checkCapacities(
+    leafCapacity: Int,
+    internalCapacity: Int
+  ) {
+    precondition(validCapacities.contains(leafCapacity),
+                 "Leaf capacity must be in \(validCapacities)")
+    precondition(validCapacities.contains(internalCapacity),
+                 "Internal capacity must be in \(validCapacities)")
+  }
 }
 
 // MARK: Mutating Operations
@@ -172,7 +231,14 @@ extension _BTree {
     invalidateIndices()
     defer { self.checkInvariants() }
     
-    let result = self.root.update { $0.updateAnyValue(value, forKey: key, updatingKey: updatingKey) }
+    let result = self.root.update {
+      $0.updateAnyValue(
+        value,
+        forKey: key,
+        updatingKey: updatingKey,
+        isRightEdge: true
+      )
+    }
     switch result {
     case let .updated(previousValue):
       return previousValue
@@ -187,6 +253,27 @@ extension _BTree {
     return nil
   }
   
+  /// Appends an element whose key is greater than every key in the tree.
+  ///
+  /// This skips the search for the insertion point, and fills the last leaf
+  /// completely before starting a new one.
+  ///
+  /// - Parameter element: The element to append.
+  /// - Complexity: O(`log n`)
+  @inlinable
+  internal mutating func append(_ element: __owned Element) {
+    invalidateIndices()
+    defer { self.checkInvariants() }
+    
+    let splinter = self.root.update { $0.appendAtRightEdge(element) }
+    if let splinter = splinter {
+      self.root = splinter.toNode(
+        leftChild: self.root,
+        capacity: self.internalCapacity
+      )
+    }
+  }
+  
   /// Verifies if the tree is balanced post-removal
   /// - Warning: This does not invalidate indices.
   @inlinable
@@ -203,6 +290,36 @@ extension _BTree {
     }
   }
   
+  /// Brings the nodes along the right edge of the tree back to their minimum
+  /// element counts.
+  ///
+  /// Insertions past the end of the tree may leave the last leaf with fewer
+  /// elements than other leaves. That is fine while it remains the last leaf,
+  /// but it must be rebalanced before another tree gets appended to this one.
+  ///
+  /// - Warning: This does not invalidate indices.
+  @inlinable
+  internal mutating func _balanceRightEdge() {
+    func balance(_ handle: Node.UnsafeHandle) {
+      if handle.isLeaf { return }
+      
+      let slot = handle.childCount - 1
+      handle[childAt: slot].update { balance($0) }
+      guard slot > 0 else { return }
+      
+      while !handle[childAt: slot].read({ $0.isBalanced }) &&
+              handle[childAt: slot - 1].read({ $0.isShrinkable }) {
+        handle.rotateRight(atSlot: slot - 1)
+      }
+      if !handle[childAt: slot].read({ $0.isBalanced }) {
+        handle.collapse(atSlot: slot - 1)
+      }
+    }
+    
+    self.root.update { balance($0) }
+    self._balanceRoot()
+  }
+  
   /// Removes the key-value pair corresponding to the first found instance of the key.
   ///
   /// This may not be the first instance of the key. This is marginally more efficient for trees
@@ -573,6 +690,10 @@ extension _BTree {
       transform
     )
     
-    return _BTree<Key, T>(rootedAt: root, internalCapacity: internalCapacity)
+    return _BTree<Key, T>(
+      rootedAt: root,
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity
+    )
   }
 }
@@ -102,7 +102,9 @@ extension _Node {
   /// and unsafe APIs for operations.
   ///
   /// A node contains a tail-allocated contiguous buffer of keys, and also may maintain pointers to buffers
-  /// for the corresponding values and children.
+  /// for the corresponding values and children. These buffers are tail-allocated after the keys, within
+  /// the same allocation as the node itself, so creating or destroying a node costs a single heap
+  /// allocation rather than up to three.
   ///
   /// There are two types of nodes distinguished "leaf" and "internal" nodes. Leaf nodes do not have a
   /// buffer allocated for their children in the underlying storage class.
@@ -162,23 +164,73 @@ extension _Node {
       withCapacity capacity: Int,
       isLeaf: Bool
     ) -> Storage {
-      let storage = Storage.create(minimumCapacity: capacity) { _ in
+      let storage = Storage.create(
+        minimumCapacity: _tailCapacity(forCapacity: capacity, isLeaf: isLeaf)
+      ) { _ in
         Header(
           capacity: capacity,
           count: 0,
           subtreeCount: 0,
           depth: 0,
-          values:
-            Value.self == Void.self ? nil
-            : UnsafeMutablePointer<Value>.allocate(capacity: capacity),
-          children: isLeaf ? nil
-            : UnsafeMutablePointer<_Node>.allocate(capacity: capacity + 1)
+          values: nil,
+          children: nil
         )
       }
       
+      storage.withUnsafeMutablePointers { header, keys in
+        var end = UnsafeMutableRawPointer(keys + capacity)
+        
+        if _Node.hasValues {
+          let values = _alignedUp(end, for: Value.self)
+            .bindMemory(to: Value.self, capacity: capacity)
+          header.pointee.values = values
+          end = UnsafeMutableRawPointer(values + capacity)
+        }
+        
+        if !isLeaf {
+          header.pointee.children = _alignedUp(end, for: _Node.self)
+            .bindMemory(to: _Node.self, capacity: capacity + 1)
+        }
+      }
+      
       return unsafeDowncast(storage, to: Storage.self)
     }
     
+    /// The number of keys to tail-allocate for a node, so that there is
+    /// enough room left after its keys for its values and children buffers,
+    /// including any padding needed to align them.
+    @inlinable
+    @inline(__always)
+    internal static func _tailCapacity(
+      forCapacity capacity: Int,
+      isLeaf: Bool
+    ) -> Int {
+      var byteCount = capacity * MemoryLayout<Key>.stride
+      if _Node.hasValues {
+        byteCount += MemoryLayout<Value>.alignment - 1
+        byteCount += capacity * MemoryLayout<Value>.stride
+      }
+      if !isLeaf {
+        byteCount += MemoryLayout<_Node>.alignment - 1
+        byteCount += (capacity + 1) * MemoryLayout<_Node>.stride
+      }
+      
+      let keyStride = MemoryLayout<Key>.stride
+      return (byteCount + keyStride - 1) / keyStride
+    }
+    
+    /// Rounds a pointer up to the alignment of the given type.
+    @inlinable
+    @inline(__always)
+    internal static func _alignedUp<T>(
+      _ pointer: UnsafeMutableRawPointer,
+      for type: T.Type
+    ) -> UnsafeMutableRawPointer {
+      let mask = UInt(MemoryLayout<T>.alignment - 1)
+      let address = (UInt(bitPattern: pointer) + mask) & ~mask
+      return UnsafeMutableRawPointer(bitPattern: address).unsafelyUnwrapped
+    }
+    
     /// Copies an existing storage to a new storage.
     ///
     /// It is generally recommended to use the ``_Node.init(copyingFrom:)`` initializer.
@@ -225,17 +277,13 @@ extension _Node {
       self.withUnsafeMutablePointers { header, elements in
         let count = header.pointee.count
         
+        // The values and children buffers are part of this object's
+        // allocation, so they only need to be deinitialized.
         if _Node.hasValues {
-          let values = header.pointee.values.unsafelyUnwrapped
-          values.deinitialize(count: count)
-          values.deallocate()
+          header.pointee.values.unsafelyUnwrapped.deinitialize(count: count)
         }
         
-        
-        if let children = header.pointee.children {
-          children.deinitialize(count: count + 1)
-          children.deallocate()
-        }
+        header.pointee.children?.deinitialize(count: count + 1)
         
         elements.deinitialize(count: header.pointee.count)
       }
@@ -39,21 +39,33 @@ extension _Node.UnsafeHandle {
   ///
   /// If a matching key is found, only the value will be updated.
   ///
+  /// On the right edge of the tree, keys greater than every existing key are
+  /// appended without searching the nodes on their path, and a full last leaf
+  /// is split at its right edge rather than at its median. This keeps leaves
+  /// filled when keys are inserted in ascending order.
+  ///
   /// - Parameters:
   ///   - value: The value to insert or update.
   ///   - key: The key to equate.
   ///   - updatingKey: If the key is found, whether it should be updated.
+  ///   - isRightEdge: Whether the node lies on the right edge of the tree.
   /// - Returns: A representation of the possible results of the update/insertion.
   @inlinable
   @inline(__always)
   internal func updateAnyValue(
     _ value: Value,
     forKey key: Key,
-    updatingKey: Bool
+    updatingKey: Bool,
+    isRightEdge: Bool = false
   ) -> UpdateResult {
     assertMutable()
     
-    let insertionIndex = self.endSlot(forKey: key)
+    let insertionIndex: Int
+    if isRightEdge && elementCount > 0 && self[keyAt: elementCount - 1] < key {
+      insertionIndex = elementCount
+    } else {
+      insertionIndex = self.endSlot(forKey: key)
+    }
 
     if 0 < insertionIndex && insertionIndex <= self.elementCount &&
         self[keyAt: insertionIndex - 1] == key {
@@ -83,6 +95,10 @@ extension _Node.UnsafeHandle {
     // We need to try to insert as deep as possible as first, and have the splinter
     // bubble up.
     if self.isLeaf {
+      if isRightEdge && insertionIndex == elementCount && isFull {
+        return .splintered(self.splitAtRightEdge(appending: (key, value)))
+      }
+      
       let maybeSplinter = self.insertElement(
         (key, value),
         withRightChild: nil,
@@ -90,8 +106,14 @@ extension _Node.UnsafeHandle {
       )
       return UpdateResult(from: maybeSplinter)
     } else {
+      let isChildOnRightEdge = isRightEdge && insertionIndex == elementCount
       let result = self[childAt: insertionIndex].update {
-        $0.updateAnyValue(value, forKey: key, updatingKey: updatingKey)
+        $0.updateAnyValue(
+          value,
+          forKey: key,
+          updatingKey: updatingKey,
+          isRightEdge: isChildOnRightEdge
+        )
       }
 
       switch result {
@@ -108,6 +130,71 @@ extension _Node.UnsafeHandle {
   }
 }
 
+// MARK: Right Edge Insertions
+extension _Node.UnsafeHandle {
+  /// Appends an element whose key is greater than every key in the subtree,
+  /// which must lie on the right edge of its tree.
+  ///
+  /// This descends along the last children without searching any node, and
+  /// fills the last leaf completely before splitting it at its right edge.
+  ///
+  /// - Parameter element: The element to append.
+  /// - Returns: A splinter object if node splintered during the insert,
+  ///     otherwise `nil`
+  @inlinable
+  internal func appendAtRightEdge(
+    _ element: __owned _Node.Element
+  ) -> _Node.Splinter? {
+    assertMutable()
+    
+    if self.isLeaf {
+      precondition(
+        elementCount == 0 || self[keyAt: elementCount - 1] < element.key,
+        "Appended keys must be greater than existing keys")
+      
+      if self.isFull {
+        return self.splitAtRightEdge(appending: element)
+      }
+      self.appendElement(element)
+      return nil
+    }
+    
+    let splinter = self[childAt: elementCount].update {
+      $0.appendAtRightEdge(element)
+    }
+    if let splinter = splinter {
+      return self.insertSplinter(splinter, atSlot: elementCount)
+    }
+    self.subtreeCount += 1
+    return nil
+  }
+  
+  /// Splits a full leaf at the last leaf of its tree to make room for an
+  /// element greater than all of its elements.
+  ///
+  /// Rather than moving half of the elements into a new leaf, only the new
+  /// element starts the new leaf, and the last element is handed up as the
+  /// separator. The split leaf is left almost full, which is what ascending
+  /// insertions want, at the cost of leaving the new last leaf with fewer
+  /// than the minimum number of elements. Only the last leaf of a tree may be
+  /// in that state; see `_BTree._balanceRightEdge()`.
+  ///
+  /// - Parameter element: The element to start the new leaf with.
+  /// - Returns: A splinter with the new leaf as its right child.
+  @inlinable
+  internal func splitAtRightEdge(
+    appending element: __owned _Node.Element
+  ) -> _Node.Splinter {
+    assertMutable()
+    assert(self.isLeaf && self.isFull, "Can only split full leaves.")
+    
+    let separator = self.removeElement(atSlot: elementCount - 1)
+    let rightNode = _Node(withCapacity: self.capacity, isLeaf: true)
+    rightNode.storage.updateGuaranteedUnique { $0.appendElement(element) }
+    return _Node.Splinter(element: separator, rightChild: rightNode)
+  }
+}
+
 // MARK: Immediate Node Insertions
 extension _Node.UnsafeHandle {
   /// Inserts a value into this node without considering the children. Be careful when using
@@ -470,6 +557,13 @@ extension _Node.UnsafeHandle {
               toSlot: self.childCount,
               of: self
             )
+            
+            rightHandle.moveInitializeChildren(
+              count: rightHandle.elementCount - separatorSlotInRightHandle,
+              fromSlot: separatorSlotInRightHandle + 1,
+              toSlot: 0,
+              of: rightHandle
+            )
           }
           
           self.elementCount = separatorSlot
@@ -494,7 +588,7 @@ extension _Node.UnsafeHandle {
         )
         
         if !self.isLeaf {
-          rightHandle.moveInitializeElements(
+          rightHandle.moveInitializeChildren(
             count: rightHandle.childCount,
             fromSlot: 0,
             toSlot: self.childCount,
@@ -0,0 +1,136 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+// MARK: Vectorized Key Search
+extension _Node.UnsafeHandle {
+  /// The largest number of keys that are scanned with vector comparisons.
+  /// Larger nodes are first narrowed down to a range of this size with a
+  /// binary search.
+  @inlinable
+  @inline(__always)
+  internal static var vectorSearchWindow: Int { 64 }
+
+  /// Finds the slot of a key with vector comparisons, if the node's keys are
+  /// of a fixed-width integer or floating-point type.
+  ///
+  /// As keys within a node are sorted, the first slot for a key is the number
+  /// of keys that are less than it, and the slot after its last instance is
+  /// the number of keys less than or equal to it. Counting these with vector
+  /// comparisons over the contiguous key buffer is branchless, unlike a
+  /// binary search, whose branches are unpredictable.
+  ///
+  /// The type checks fold away once the node is specialized for a concrete
+  /// key type, so this costs nothing for other key types.
+  ///
+  /// - Parameters:
+  ///   - key: The key to search for within the node.
+  ///   - orEqual: Whether to count keys equal to `key`, i.e. to return the
+  ///       result of `endSlot(forKey:)` rather than `startSlot(forKey:)`.
+  /// - Returns: The slot of the key, or `nil` if keys of this type can't be
+  ///     compared with vector instructions.
+  @inlinable
+  @inline(__always)
+  internal func _vectorizedSlot(forKey key: Key, orEqual: Bool) -> Int? {
+    if Key.self == Int.self {
+      return _vectorizedSlot(forKey: key, as: Int.self, orEqual: orEqual)
+    }
+    if Key.self == Int64.self {
+      return _vectorizedSlot(forKey: key, as: Int64.self, orEqual: orEqual)
+    }
+    if Key.self == Int32.self {
+      return _vectorizedSlot(forKey: key, as: Int32.self, orEqual: orEqual)
+    }
+    if Key.self == UInt.self {
+      return _vectorizedSlot(forKey: key, as: UInt.self, orEqual: orEqual)
+    }
+    if Key.self == UInt64.self {
+      return _vectorizedSlot(forKey: key, as: UInt64.self, orEqual: orEqual)
+    }
+    if Key.self == UInt32.self {
+      return _vectorizedSlot(forKey: key, as: UInt32.self, orEqual: orEqual)
+    }
+    if Key.self == Double.self {
+      return _vectorizedSlot(forKey: key, as: Double.self, orEqual: orEqual)
+    }
+    if Key.self == Float.self {
+      return _vectorizedSlot(forKey: key, as: Float.self, orEqual: orEqual)
+    }
+    return nil
+  }
+
+  /// Finds the slot of a key by reinterpreting the node's keys as `Scalar`,
+  /// which must be the same type as `Key`.
+  @inlinable
+  @inline(__always)
+  internal func _vectorizedSlot<Scalar: SIMDScalar & Comparable>(
+    forKey key: Key,
+    as scalarType: Scalar.Type,
+    orEqual: Bool
+  ) -> Int {
+    assert(Key.self == Scalar.self, "Mismatched key type")
+    let key = unsafeBitCast(key, to: Scalar.self)
+    let keys = UnsafeRawPointer(self.keys).assumingMemoryBound(to: Scalar.self)
+
+    // Narrow down large nodes to a window that is cheap to scan.
+    var start: Int = 0
+    var end: Int = self.elementCount
+    while end &- start > Self.vectorSearchWindow {
+      let mid = (end &- start) / 2 &+ start
+      if orEqual ? key >= keys[mid] : key > keys[mid] {
+        start = mid &+ 1
+      } else {
+        end = mid
+      }
+    }
+
+    return start &+ Self._countKeys(
+      in: UnsafeBufferPointer(start: keys + start, count: end &- start),
+      lessThan: key,
+      orEqual: orEqual)
+  }
+
+  /// Counts the keys of a buffer that are less than (or equal to) a given key,
+  /// eight at a time.
+  @inlinable
+  internal static func _countKeys<Scalar: SIMDScalar & Comparable>(
+    in keys: UnsafeBufferPointer<Scalar>,
+    lessThan key: Scalar,
+    orEqual: Bool
+  ) -> Int {
+    typealias Vector = SIMD8<Scalar>
+    typealias Counts = SIMD8<Scalar.SIMDMaskScalar>
+
+    if keys.isEmpty { return 0 }
+    let base = UnsafeRawPointer(keys.baseAddress.unsafelyUnwrapped)
+    let needle = Vector(repeating: key)
+    let one = Counts(repeating: 1)
+    var counts = Counts()
+
+    var i = 0
+    while i &+ Vector.scalarCount <= keys.count {
+      let chunk = base.loadUnaligned(
+        fromByteOffset: i &* MemoryLayout<Scalar>.stride,
+        as: Vector.self)
+      let mask = orEqual ? chunk .<= needle : chunk .< needle
+      counts = counts.replacing(with: counts &+ one, where: mask)
+      i &+= Vector.scalarCount
+    }
+
+    var result = Int(truncatingIfNeeded: counts.wrappedSum())
+    while i < keys.count {
+      if orEqual ? keys[i] <= key : keys[i] < key {
+        result &+= 1
+      }
+      i &+= 1
+    }
+    return result
+  }
+}
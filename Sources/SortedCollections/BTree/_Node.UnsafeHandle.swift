@@ -221,7 +221,6 @@ extension _Node {
     internal func drop() {
       assertMutable()
       assert(self.elementCount == 0, "Cannot drop non-empty node")
-      self.header.pointee.children?.deallocate()
       self.header.pointee.children = nil
     }
   }
@@ -343,6 +342,10 @@ extension _Node.UnsafeHandle {
   ///     the valid insertion point for the key.
   @inlinable
   internal func startSlot(forKey key: Key) -> Int {
+    if let slot = _vectorizedSlot(forKey: key, orEqual: false) {
+      return slot
+    }
+    
     var start: Int = 0
     var end: Int = self.elementCount
     
@@ -367,6 +370,10 @@ extension _Node.UnsafeHandle {
   ///     the valid insertion point for the key.
   @inlinable
   internal func endSlot(forKey key: Key) -> Int {
+    if let slot = _vectorizedSlot(forKey: key, orEqual: true) {
+      return slot
+    }
+    
     var start: Int = 0
     var end: Int = self.elementCount
     
@@ -382,6 +389,43 @@ extension _Node.UnsafeHandle {
     
     return end
   }
+
+  /// Performs an exponential search for a key, starting at a given slot. This
+  /// returns the same slot as `startSlot(forKey:)`, but only takes
+  /// O(log d) comparisons, where d is the distance of the result from `slot`.
+  ///
+  /// - Parameters:
+  ///   - key: The key to search for within the node.
+  ///   - slot: A slot that is known to be at or before the result, i.e. all
+  ///       keys before it must be less than `key`.
+  /// - Returns: Either the slot if the first instance of the key, otherwise
+  ///     the valid insertion point for the key.
+  @inlinable
+  internal func startSlot(forKey key: Key, from slot: Int) -> Int {
+    var start: Int = slot
+    var end: Int = slot
+    var step: Int = 1
+
+    // Gallop forward until `end` is past the insertion point.
+    while end < self.elementCount && self.keys[end] < key {
+      start = end &+ 1
+      end = end &+ step
+      step &<<= 1
+    }
+    if end > self.elementCount { end = self.elementCount }
+
+    while end > start {
+      let mid = (end &- start) / 2 &+ start
+
+      if key <= self.keys[mid] {
+        end = mid
+      } else {
+        start = mid &+ 1
+      }
+    }
+
+    return end
+  }
 }
 
 // MARK: Element-wise Buffer Operations
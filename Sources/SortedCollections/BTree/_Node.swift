@@ -83,6 +83,11 @@ internal struct _Node<Key: Comparable, Value> {
       leftChild.storage.header.depth == rightChild.storage.header.depth,
       "Left and right nodes of a splinter must have equal depth"
     )
+    // Every level of the tree takes up an entry in the fixed-size paths of
+    // indices and cursors, which overflow if the tree grows any deeper.
+    let maxDepth = Int(_FixedSizeArray<_BTree<Key, Value>.Slot>.maxSize) - 1
+    precondition(leftChild.storage.header.depth < maxDepth,
+                 "B-tree depth limit exceeded; use larger node capacities")
     
     self.init(withCapacity: capacity, isLeaf: false)
     self.storage.updateGuaranteedUnique { handle in
@@ -290,6 +295,136 @@ extension _Node {
   }
 }
 
+// MARK: Split Subroutine
+extension _Node {
+  /// Creates a node containing a copy of a contiguous range of elements of an
+  /// existing node, along with the children surrounding them.
+  ///
+  /// Children are shared with the existing node rather than copied. If the
+  /// range is empty and the node is not a leaf, this returns the single child
+  /// at `range.lowerBound` rather than an internal node without elements.
+  ///
+  /// - Parameters:
+  ///   - handle: A handle to the node to copy from.
+  ///   - range: The slots of the elements to copy.
+  /// - Returns: A node of the same capacity and depth as the existing node,
+  ///     or of a lower depth if `range` is empty.
+  @inlinable
+  internal static func _slice(
+    of handle: UnsafeHandle,
+    elementsIn range: Range<Int>
+  ) -> _Node {
+    assert(0 <= range.lowerBound && range.upperBound <= handle.elementCount,
+           "Slice out of bounds.")
+    if range.isEmpty && !handle.isLeaf {
+      return handle[childAt: range.lowerBound]
+    }
+    
+    let node = _Node(withCapacity: handle.capacity, isLeaf: handle.isLeaf)
+    node.storage.updateGuaranteedUnique { newHandle in
+      let count = range.count
+      newHandle.keys.initialize(
+        from: handle.keys.advanced(by: range.lowerBound),
+        count: count
+      )
+      if _Node.hasValues {
+        newHandle.values.unsafelyUnwrapped.initialize(
+          from: handle.values.unsafelyUnwrapped.advanced(by: range.lowerBound),
+          count: count
+        )
+      }
+      
+      var subtreeCount = count
+      if let children = newHandle.children {
+        children.initialize(
+          from: handle.children.unsafelyUnwrapped
+            .advanced(by: range.lowerBound),
+          count: count + 1
+        )
+        for i in 0...count {
+          subtreeCount += children[i].storage.header.subtreeCount
+        }
+      }
+      
+      newHandle.elementCount = count
+      newHandle.subtreeCount = subtreeCount
+      newHandle.depth = handle.depth
+    }
+    return node
+  }
+  
+  /// Splits a node into a node containing the elements with keys less than
+  /// `key` (or less than or equal to `key`), and one containing the rest.
+  ///
+  /// Only the nodes along the path to `key` are rebuilt. The subtrees on either
+  /// side of that path are shared with `node`, and grafted onto the results
+  /// with ``join(_:with:separatedBy:capacity:)``.
+  ///
+  /// The returned nodes are well-formed roots: they may contain fewer elements
+  /// than their capacity would otherwise require, and their depth may differ
+  /// from that of `node`.
+  ///
+  /// - Parameters:
+  ///   - node: The node to split. This node is not modified.
+  ///   - key: The key to split at.
+  ///   - lowerIncludesKey: Whether elements with keys equal to `key` go into
+  ///       the lower node rather than the upper one.
+  ///   - capacity: The capacity of any new internal node.
+  /// - Returns: The elements before `key`, and the elements after it.
+  @inlinable
+  internal static func split(
+    _ node: _Node,
+    atKey key: Key,
+    lowerIncludesKey: Bool,
+    capacity: Int
+  ) -> (lower: _Node, upper: _Node) {
+    node.read { handle -> (lower: _Node, upper: _Node) in
+      let slot = lowerIncludesKey
+        ? handle.endSlot(forKey: key)
+        : handle.startSlot(forKey: key)
+      
+      if handle.isLeaf {
+        return (
+          lower: _slice(of: handle, elementsIn: 0..<slot),
+          upper: _slice(of: handle, elementsIn: slot..<handle.elementCount)
+        )
+      }
+      
+      var (lower, upper) = split(
+        handle[childAt: slot],
+        atKey: key,
+        lowerIncludesKey: lowerIncludesKey,
+        capacity: capacity
+      )
+      
+      if slot > 0 {
+        var left = _slice(of: handle, elementsIn: 0..<(slot - 1))
+        lower = join(
+          &left,
+          with: &lower,
+          separatedBy: handle[elementAt: slot - 1],
+          capacity: capacity
+        )
+      }
+      
+      if slot < handle.elementCount {
+        var right = _slice(
+          of: handle,
+          elementsIn: (slot + 1)..<handle.elementCount
+        )
+        upper = join(
+          &upper,
+          with: &right,
+          separatedBy: handle[elementAt: slot],
+          capacity: capacity
+        )
+      }
+      
+      return (lower, upper)
+    }
+  }
+}
+
 // MARK: CoW
 extension _Node {
   /// Allows **read-only** access to the underlying data behind the node.
@@ -0,0 +1,302 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import Synchronization
+
+#if !COLLECTIONS_SINGLE_MODULE
+import InternalCollectionsUtilities
+#endif
+
+/// A thread-safe reference to the latest version of a sorted dictionary,
+/// which readers can take consistent snapshots of while writers keep
+/// updating it.
+///
+/// Each version of the dictionary is an immutable B-tree. Writers update a
+/// copy of the latest version, which only copies the nodes along the paths
+/// to the modified elements and shares all other nodes with the previous
+/// version, and then atomically publish the result as the new latest
+/// version:
+///
+///     let prices = ConcurrentSortedDictionary<String, Int>()
+///     // On a writer thread:
+///     prices.update { $0["apple"] = 3 }
+///     // On any number of reader threads:
+///     let snapshot = prices.snapshot()
+///     for (name, price) in snapshot { ... }
+///
+/// Taking a snapshot never blocks and never waits for writers, and readers
+/// on different threads mostly touch separate cache lines, so reads scale
+/// across cores. A snapshot is an ordinary `SortedDictionary` value that
+/// remains valid and unchanged for as long as the reader holds on to it.
+///
+/// Updates are serialized with a lock. Before releasing the version it
+/// replaced, an update waits for readers that are in the middle of taking a
+/// snapshot of it, which takes only a few instructions per reader.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+public final class ConcurrentSortedDictionary<Key: Comparable, Value> {
+  @usableFromInline
+  internal typealias _Tree = _BTree<Key, Value>
+
+  /// A published version of the dictionary.
+  @usableFromInline
+  internal final class _Version {
+    @usableFromInline
+    internal let tree: _Tree
+
+    @inlinable
+    internal init(_ tree: _Tree) {
+      self.tree = tree
+    }
+  }
+
+  /// The latest version, which this object holds a strong reference to.
+  @usableFromInline
+  internal let _current: Atomic<Unmanaged<_Version>>
+
+  /// Counts the readers that may be accessing a version, by parity of the
+  /// epoch in which they started.
+  @usableFromInline
+  internal let _readers: _ReaderCounts
+
+  /// Incremented by every update after it publishes a new version.
+  @usableFromInline
+  internal let _epoch: Atomic<Int>
+
+  /// Serializes updates.
+  @usableFromInline
+  internal let _writerLock: Mutex<Void>
+
+  /// Creates a concurrent sorted dictionary whose initial version is the
+  /// given dictionary.
+  ///
+  /// - Parameter dictionary: The initial contents of the dictionary.
+  /// - Complexity: O(1)
+  public init(_ dictionary: SortedDictionary<Key, Value> = [:]) {
+    self._current = Atomic(.passRetained(_Version(dictionary._root)))
+    self._readers = _ReaderCounts()
+    self._epoch = Atomic(0)
+    self._writerLock = Mutex(())
+  }
+
+  deinit {
+    _current.load(ordering: .acquiring).release()
+  }
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension ConcurrentSortedDictionary: @unchecked Sendable
+where Key: Sendable, Value: Sendable {}
+
+// MARK: Reading
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension ConcurrentSortedDictionary {
+  /// Calls the given closure with the tree of the latest version, which is
+  /// guaranteed to stay alive until the closure returns.
+  ///
+  /// The reader registers itself in the counter of the current epoch before
+  /// loading the latest version, so that an update that replaces the version
+  /// in the meantime waits for the reader before releasing it.
+  ///
+  /// - Warning: Updates that replace the version are blocked until `body`
+  ///     returns, so it must return quickly. To do more than retain the
+  ///     tree, retain it and work on it after this returns.
+  @inlinable
+  internal func _withLatestTree<R>(_ body: (_Tree) -> R) -> R {
+    let stripe = _ReaderCounts.currentStripe()
+    while true {
+      let epoch = _epoch.load(ordering: .sequentiallyConsistent)
+      _readers.add(1, parity: epoch & 1, stripe: stripe)
+      defer { _readers.add(-1, parity: epoch & 1, stripe: stripe) }
+
+      // If an update flipped the epoch before we registered, it may not
+      // wait for us, so we have to register in the new epoch instead.
+      if _epoch.load(ordering: .sequentiallyConsistent) == epoch {
+        return _current.load(ordering: .sequentiallyConsistent)
+          ._withUnsafeGuaranteedRef { body($0.tree) }
+      }
+    }
+  }
+
+  /// Returns the latest version of the dictionary.
+  ///
+  /// The snapshot shares its storage with the concurrent dictionary, and is
+  /// unaffected by later updates.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public func snapshot() -> SortedDictionary<Key, Value> {
+    SortedDictionary(_rootedAt: _withLatestTree { $0 })
+  }
+
+  /// Returns the value associated with the given key in the latest version
+  /// of the dictionary, or `nil` if the key isn't present.
+  ///
+  /// - Parameter key: The key to find in the dictionary.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the dictionary.
+  @inlinable
+  public subscript(key: Key) -> Value? {
+    // Search a retained copy of the tree, so that updates don't have to wait
+    // for the search to finish.
+    let tree = _withLatestTree { $0 }
+    return tree.findAnyValue(forKey: key)
+  }
+}
+
+// MARK: Updating
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension ConcurrentSortedDictionary {
+  /// Updates the dictionary by calling the given closure with a copy of its
+  /// latest version, then publishes the modified copy as the new latest
+  /// version.
+  ///
+  /// Readers see either all or none of the changes made by `body`, so
+  /// batching several changes into a single update both keeps them
+  /// consistent and copies each modified node only once.
+  ///
+  /// Updates from different threads are serialized.
+  ///
+  /// - Parameter body: A closure that modifies the dictionary.
+  /// - Returns: The value returned by `body`.
+  /// - Complexity: O(`log n`) for each modified key-value pair, plus the
+  ///   complexity of `body`.
+  @inlinable
+  public func update<R>(
+    _ body: (inout SortedDictionary<Key, Value>) -> R
+  ) -> R {
+    var result: R? = nil
+    _writerLock.withLock { _ in
+      // As the previous version keeps referencing the tree, the first
+      // change to each node copies it, so that readers never see it change.
+      let previous = _current.load(ordering: .sequentiallyConsistent)
+      var dictionary = SortedDictionary(
+        _rootedAt: previous._withUnsafeGuaranteedRef { $0.tree })
+      result = body(&dictionary)
+
+      _current.store(
+        .passRetained(_Version(dictionary._root)),
+        ordering: .sequentiallyConsistent)
+      _retire(previous)
+    }
+    return result.unsafelyUnwrapped
+  }
+
+  /// Replaces the contents of the dictionary.
+  ///
+  /// - Parameter dictionary: The new latest version of the dictionary.
+  /// - Complexity: O(1), plus the cost of releasing the storage that is no
+  ///   longer referenced by any version.
+  @inlinable
+  public func store(_ dictionary: SortedDictionary<Key, Value>) {
+    update { $0 = dictionary }
+  }
+
+  /// Releases a version once no reader can be in the middle of taking it.
+  ///
+  /// This flips the epoch, then waits for the readers that registered in
+  /// the previous epoch; readers that register in the new one can only see
+  /// the latest version.
+  @usableFromInline
+  internal func _retire(_ version: Unmanaged<_Version>) {
+    let (epoch, _) = _epoch.add(1, ordering: .sequentiallyConsistent)
+    for stripe in 0 ..< _ReaderCounts.stripeCount {
+      var attempts = 0
+      while _readers.count(parity: epoch & 1, stripe: stripe) != 0 {
+        attempts += 1
+        if attempts > 16 {
+          _yieldThread()
+        }
+      }
+    }
+    version.release()
+  }
+}
+
+// MARK: Reader Counts
+/// Counts of active readers, spread over separate cache lines so that
+/// readers on different threads don't contend with each other.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+@usableFromInline
+internal final class _ReaderCounts {
+  /// A reader count, padded so that no two counts share a cache line.
+  @usableFromInline
+  internal struct _Count: ~Copyable {
+    @usableFromInline
+    internal let value: Atomic<Int>
+
+    @usableFromInline
+    internal let _padding = _CacheLinePadding()
+
+    @inlinable
+    internal init() {
+      value = Atomic(0)
+    }
+  }
+
+  /// The number of counts for each parity of the epoch.
+  @inlinable
+  @inline(__always)
+  internal static var stripeCount: Int { 16 }
+
+  @usableFromInline
+  internal let _counts: UnsafeMutablePointer<_Count>
+
+  @inlinable
+  internal init() {
+    let count = 2 * Self.stripeCount
+    _counts = .allocate(capacity: count)
+    for i in 0 ..< count {
+      (_counts + i).initialize(to: _Count())
+    }
+  }
+
+  deinit {
+    _counts.deinitialize(count: 2 * Self.stripeCount)
+    _counts.deallocate()
+  }
+
+  /// Adds the given value to the reader count for an epoch parity and
+  /// stripe.
+  @inlinable
+  @inline(__always)
+  internal func add(_ delta: Int, parity: Int, stripe: Int) {
+    _counts[parity &* Self.stripeCount &+ stripe].value
+      .add(delta, ordering: .sequentiallyConsistent)
+  }
+
+  /// Returns the reader count for an epoch parity and stripe.
+  @inlinable
+  @inline(__always)
+  internal func count(parity: Int, stripe: Int) -> Int {
+    _counts[parity &* Self.stripeCount &+ stripe].value
+      .load(ordering: .sequentiallyConsistent)
+  }
+
+  /// Returns the stripe for the calling thread to use.
+  ///
+  /// Threads run on separate stacks, so the address of a local variable is a
+  /// cheap way to spread them over the stripes. Correctness doesn't depend
+  /// on which stripe a reader picks.
+  @inlinable
+  @inline(__always)
+  internal static func currentStripe() -> Int {
+    var marker: UInt8 = 0
+    let address = withUnsafeMutablePointer(to: &marker) {
+      UInt(bitPattern: $0)
+    }
+    let multiplier = UInt(truncatingIfNeeded: 0x9E37_79B9_7F4A_7C15 as UInt64)
+    let hash = (address >> 12) &* multiplier
+    // The top four bits select one of the 16 stripes.
+    return Int(truncatingIfNeeded: hash >> (UInt.bitWidth - 4))
+  }
+}
+#endif
@@ -12,41 +12,12 @@
 extension SortedDictionary: CustomStringConvertible, CustomDebugStringConvertible {
   @inlinable
   public var description: String {
-    if isEmpty { return "[:]" }
-    var result = "["
-    var first = true
-    for (key, value) in self {
-      if first {
-        first = false
-      } else {
-        result += ", "
-      }
-      result += "\(key): \(value)"
-    }
-    result += "]"
-    return result
+    _sortedDictionaryDescription(for: self)
   }
   
   @inlinable
   public var debugDescription: String {
-    var result = "SortedDictionary<\(Key.self), \(Value.self)>("
-    if isEmpty {
-      result += "[:]"
-    } else {
-      result += "["
-      var first = true
-      for (key, value) in self {
-        if first {
-          first = false
-        } else {
-          result += ", "
-        }
-        
-        debugPrint(key, value, separator: ": ", terminator: "", to: &result)
-      }
-      result += "]"
-    }
-    result += ")"
-    return result
+    _sortedDictionaryDebugDescription(
+      for: self, typeName: "SortedDictionary<\(Key.self), \(Value.self)>")
   }
 }
@@ -108,6 +108,43 @@ extension SortedDictionary {
     self.init(_rootedAt: builder.finish())
   }
   
+  /// Creates a dictionary from a sequence of **sorted** key-value pairs,
+  /// whose underlying B-tree nodes hold the specified numbers of elements.
+  ///
+  /// - Parameters:
+  ///   - keysAndValues: A sequence of key-value pairs in non-decreasing
+  ///      comparison order for the new dictionary.
+  ///   - leafCapacity: The maximum number of elements in a leaf node. This
+  ///      must be between 4 and 65534.
+  ///   - internalCapacity: The maximum number of elements in an internal
+  ///      node. This must be between 4 and 65534.
+  /// - Complexity: O(`n`) where `n` is the number of elements in the
+  ///     sequence.
+  @inlinable
+  public init<S>(
+    sortedKeysWithValues keysAndValues: S,
+    leafCapacity: Int,
+    internalCapacity: Int
+  ) where S: Sequence, S.Element == (key: Key, value: Value) {
+    _Tree._checkCapacities(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity)
+    var builder = _Tree.Builder(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity
+    )
+    
+    var previousKey: Key? = nil
+    for (key, value) in keysAndValues {
+      precondition(previousKey == nil || previousKey! < key,
+             "Sequence out of order.")
+      builder.append((key, value))
+      previousKey = key
+    }
+    
+    self.init(_rootedAt: builder.finish())
+  }
+  
   /// Creates a new sorted dictionary whose keys are the groupings returned
   /// by the given closure and whose values are arrays of the elements that
   /// returned each key.
@@ -144,8 +144,8 @@ extension SortedDictionary {
   /// - Parameter bounds: The subrange of the collection to remove. The bounds of the
   ///     range must be valid indices of the collection.
   /// - Returns: The key-value pair that correspond to `index`.
-  /// - Complexity: O(`m log n`) where `n` is the number of key-value pairs in the
-  ///   sorted dictionary, and `m` is the size of `bounds`
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in the
+  ///   sorted dictionary.
   @inlinable
   @inline(__always)
   internal mutating func removeSubrange<R: RangeExpression>(
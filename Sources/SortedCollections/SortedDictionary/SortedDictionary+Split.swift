@@ -0,0 +1,211 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension SortedDictionary {
+  /// Splits the dictionary into a dictionary of the key-value pairs whose
+  /// keys are less than the given key, and one with the remaining pairs.
+  ///
+  ///     let d: SortedDictionary = [1: "a", 2: "b", 3: "c", 4: "d"]
+  ///     let (lower, upper) = d.split(at: 3)
+  ///     // lower == [1: "a", 2: "b"]
+  ///     // upper == [3: "c", 4: "d"]
+  ///
+  /// This does not copy the key-value pairs: only the nodes along the path to
+  /// `key` are rebuilt, and both results share the rest of their storage with
+  /// this dictionary.
+  ///
+  /// - Parameter key: The key to split at. This doesn't need to be present
+  ///     in the dictionary.
+  /// - Returns: A dictionary with the keys less than `key`, and a dictionary
+  ///     with the keys greater than or equal to `key`.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  public func split(at key: Key) -> (lower: Self, upper: Self) {
+    let (lower, upper) = self._root.split(atKey: key)
+    return (
+      lower: SortedDictionary(_rootedAt: lower),
+      upper: SortedDictionary(_rootedAt: upper)
+    )
+  }
+
+  /// Appends the key-value pairs of another dictionary, whose keys must all
+  /// be greater than the keys of this dictionary.
+  ///
+  ///     var d: SortedDictionary = [1: "a", 2: "b"]
+  ///     d.append(contentsOf: [3: "c", 4: "d"])
+  ///     // d == [1: "a", 2: "b", 3: "c", 4: "d"]
+  ///
+  /// This is the inverse of ``split(at:)``. Instead of inserting the new
+  /// key-value pairs one by one, the two underlying trees are stitched
+  /// together along one edge, sharing the rest of their storage with `other`.
+  ///
+  /// Calling this method invalidates all indices with respect to the
+  /// dictionary.
+  ///
+  /// - Parameter other: A sorted dictionary whose smallest key is greater
+  ///     than the largest key of this dictionary.
+  /// - Complexity: O(`log n + log m`) where `n` and `m` are the number of
+  ///   key-value pairs in the two dictionaries, if they were created with the
+  ///   same node capacities. Otherwise, O(`n + m`).
+  @inlinable
+  public mutating func append(contentsOf other: __owned Self) {
+    if let last = self._root.last, let first = other._root.first {
+      precondition(last.key < first.key,
+                   "Appended keys must be greater than existing keys")
+    }
+    self._root.append(contentsOf: other._root)
+  }
+}
+
+// MARK: Key Range Removal
+extension SortedDictionary {
+  /// Removes the key-value pairs whose keys fall within the given range, and
+  /// returns them as a new dictionary.
+  ///
+  ///     var d: SortedDictionary = [1: "a", 2: "b", 3: "c", 4: "d"]
+  ///     let removed = d.extractSubrange(2 ..< 4)
+  ///     // removed == [2: "b", 3: "c"]
+  ///     // d == [1: "a", 4: "d"]
+  ///
+  /// The dictionary is split at both ends of the range, and the two outer
+  /// parts are then joined back together. Whole subtrees are moved rather
+  /// than the key-value pairs within them, so only the nodes along the two
+  /// boundaries of the range get rebuilt.
+  ///
+  /// Calling this method invalidates all indices with respect to the
+  /// dictionary.
+  ///
+  /// - Parameter keys: The range of keys to remove. The bounds of the range
+  ///     don't need to be present in the dictionary.
+  /// - Returns: A dictionary containing the removed key-value pairs.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func extractSubrange(_ keys: Range<Key>) -> Self {
+    SortedDictionary(_rootedAt: _root.extractElements(
+      from: (key: keys.lowerBound, isInclusive: true),
+      to: (key: keys.upperBound, isInclusive: false)))
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range, and
+  /// returns them as a new dictionary.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func extractSubrange(_ keys: ClosedRange<Key>) -> Self {
+    SortedDictionary(_rootedAt: _root.extractElements(
+      from: (key: keys.lowerBound, isInclusive: true),
+      to: (key: keys.upperBound, isInclusive: true)))
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range, and
+  /// returns them as a new dictionary.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func extractSubrange(_ keys: PartialRangeFrom<Key>) -> Self {
+    SortedDictionary(_rootedAt: _root.extractElements(
+      from: (key: keys.lowerBound, isInclusive: true),
+      to: nil))
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range, and
+  /// returns them as a new dictionary.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func extractSubrange(_ keys: PartialRangeUpTo<Key>) -> Self {
+    SortedDictionary(_rootedAt: _root.extractElements(
+      from: nil,
+      to: (key: keys.upperBound, isInclusive: false)))
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range, and
+  /// returns them as a new dictionary.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func extractSubrange(
+    _ keys: PartialRangeThrough<Key>
+  ) -> Self {
+    SortedDictionary(_rootedAt: _root.extractElements(
+      from: nil,
+      to: (key: keys.upperBound, isInclusive: true)))
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range.
+  ///
+  ///     var events: SortedDictionary = [10: "a", 20: "b", 30: "c"]
+  ///     events.removeSubrange(..<25)
+  ///     // events == [30: "c"]
+  ///
+  /// This detaches whole subtrees instead of removing the key-value pairs
+  /// one by one. See `extractSubrange(_:)` for details.
+  ///
+  /// Calling this method invalidates all indices with respect to the
+  /// dictionary.
+  ///
+  /// - Parameter keys: The range of keys to remove. The bounds of the range
+  ///     don't need to be present in the dictionary.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  public mutating func removeSubrange(_ keys: Range<Key>) {
+    extractSubrange(keys)
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  public mutating func removeSubrange(_ keys: ClosedRange<Key>) {
+    extractSubrange(keys)
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  public mutating func removeSubrange(_ keys: PartialRangeFrom<Key>) {
+    extractSubrange(keys)
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  public mutating func removeSubrange(_ keys: PartialRangeUpTo<Key>) {
+    extractSubrange(keys)
+  }
+
+  /// Removes the key-value pairs whose keys fall within the given range.
+  ///
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the sorted dictionary.
+  @inlinable
+  public mutating func removeSubrange(_ keys: PartialRangeThrough<Key>) {
+    extractSubrange(keys)
+  }
+}
+
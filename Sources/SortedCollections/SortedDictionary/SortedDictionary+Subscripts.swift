@@ -174,3 +174,31 @@ extension SortedDictionary {
     return SubSequence(_root[bound])
   }
 }
+
+// MARK: Batched Lookups
+extension SortedDictionary {
+  /// Returns the values associated with a sequence of keys in ascending order.
+  ///
+  ///     let d: SortedDictionary = [1: "a", 3: "c", 5: "e", 7: "g"]
+  ///     d.values(forSortedKeys: [3, 4, 7])
+  ///     // ["c", nil, "g"]
+  ///
+  /// Rather than searching for each key from the root of the underlying
+  /// tree, each search resumes from where the previous one ended, climbing
+  /// only as far as needed to reach the next key. This makes looking up a
+  /// sorted batch of keys considerably cheaper than using the key-based
+  /// subscript in a loop, especially when the keys are close together.
+  ///
+  /// - Parameter keys: A sequence of keys in ascending order. The sequence
+  ///     may contain duplicates and keys that are not in the dictionary.
+  /// - Returns: An array containing the value associated with each key in
+  ///     `keys` if the key is in the dictionary; otherwise, `nil`.
+  /// - Complexity: O(`m log(n/m)`) where `m` is the number of keys and `n`
+  ///   the number of key-value pairs in the dictionary.
+  @inlinable
+  public func values<S: Sequence>(
+    forSortedKeys keys: S
+  ) -> [Value?] where S.Element == Key {
+    self._root.findAnyValues(forSortedKeys: keys)
+  }
+}
@@ -34,6 +34,39 @@ public struct SortedDictionary<Key: Comparable, Value> {
     self._root = _Tree()
   }
   
+  /// Creates an empty dictionary whose underlying B-tree nodes hold the
+  /// specified numbers of elements.
+  ///
+  /// By default, nodes are sized to a small number of elements based on the
+  /// size of `Key`. Larger nodes make for shallower trees with fewer
+  /// allocations, which speeds up lookups and iteration over large
+  /// dictionaries, at the cost of moving more elements around on each
+  /// insertion and removal.
+  ///
+  /// The capacities apply to the lifetime of the dictionary, including any
+  /// copies of it, and dictionaries derived from it by operations such as
+  /// `filter(_:)`.
+  ///
+  /// - Parameters:
+  ///   - leafCapacity: The maximum number of elements in a leaf node. This
+  ///      must be between 4 and 65534.
+  ///   - internalCapacity: The maximum number of elements in an internal
+  ///      node. This must be between 4 and 65534. Very small internal
+  ///      capacities limit the size of the dictionary, as its tree can be at
+  ///      most 16 levels deep: with a capacity of 4, it can hold tens of
+  ///      millions of elements.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public init(leafCapacity: Int, internalCapacity: Int) {
+    _Tree._checkCapacities(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity)
+    self._root = _Tree(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity)
+  }
+  
   /// Creates a dictionary rooted at a given BTree.
   @inlinable
   internal init(_rootedAt tree: _Tree) {
@@ -150,6 +183,35 @@ extension SortedDictionary {
   public mutating func updateValue(_ value: Value, forKey key: Key) -> Value? {
     self._root.updateAnyValue(value, forKey: key)?.value
   }
+  
+  /// Adds a new key-value pair whose key is greater than every key in the
+  /// dictionary.
+  ///
+  ///     var readings: SortedDictionary<Int, Double> = [:]
+  ///     readings.append((key: 1, value: 20.5))
+  ///     readings.append((key: 2, value: 21.0))
+  ///
+  /// This is the most efficient way to add keys in ascending order, such as
+  /// timestamps of incoming events. The new key-value pair is added to the end
+  /// of the underlying tree without searching for its position, and full
+  /// nodes are split in a way that keeps them as full as possible.
+  ///
+  /// Inserting keys in ascending order with `updateValue(_:forKey:)` or the
+  /// key-based subscript benefits from the same layout, but those still
+  /// compare the key against the existing keys along the way.
+  ///
+  /// Calling this method invalidates any existing indices for use with this
+  /// sorted dictionary.
+  ///
+  /// - Parameter element: The key-value pair to add. Its key must be greater
+  ///     than every key in the dictionary.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in the
+  ///   dictionary, but without any key comparisons beyond the one checking
+  ///   the precondition.
+  @inlinable
+  public mutating func append(_ element: __owned Element) {
+    self._root.append(element)
+  }
 }
 
 // MARK: Removing Keys and Values
@@ -208,7 +270,10 @@ extension SortedDictionary {
     // TODO: Optimize to reuse dictionary structure.
     // TODO: optimize to use identify fastest iteration method
     // TODO: optimize CoW checks
-    var builder = _BTree<Key, T>.Builder()
+    var builder = _BTree<Key, T>.Builder(
+      leafCapacity: _root.leafCapacity,
+      internalCapacity: _root.internalCapacity
+    )
     
     for (key, value) in self {
       if let newValue = try transform(value) {
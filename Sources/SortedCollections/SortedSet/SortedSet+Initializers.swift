@@ -50,4 +50,41 @@ extension SortedSet {
     
     self.init(_rootedAt: builder.finish())
   }
+  
+  /// Creates a set from a sequence of **sorted** elements, whose underlying
+  /// B-tree nodes hold the specified numbers of elements.
+  ///
+  /// - Parameters:
+  ///   - elements: A sequence of elements in non-decreasing comparison order
+  ///      for the new set.
+  ///   - leafCapacity: The maximum number of elements in a leaf node. This
+  ///      must be between 4 and 65534.
+  ///   - internalCapacity: The maximum number of elements in an internal
+  ///      node. This must be between 4 and 65534.
+  /// - Complexity: O(`n`) where `n` is the number of elements in the
+  ///     sequence.
+  @inlinable
+  public init<S: Sequence>(
+    sortedElements elements: S,
+    leafCapacity: Int,
+    internalCapacity: Int
+  ) where S.Element == Element {
+    _Tree._checkCapacities(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity)
+    var builder = _Tree.Builder(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity
+    )
+    
+    var previousElement: Element? = nil
+    for element in elements {
+      precondition(previousElement == nil || previousElement! < element,
+             "Sequence out of order.")
+      builder.append(element)
+      previousElement = element
+    }
+    
+    self.init(_rootedAt: builder.finish())
+  }
 }
@@ -144,14 +144,13 @@ extension SortedSet {
   /// - Parameter bounds: The subrange of the collection to remove. The bounds of the
   ///     range must be valid indices of the collection.
   /// - Returns: The key-value pair that correspond to `index`.
-  /// - Complexity: O(`m log n`) where `n` is the number of elements in the
-  ///   sorted set, and `m` is the size of `bounds`
+  /// - Complexity: O(`log n`) where `n` is the number of elements in the
+  ///   sorted set.
   @inlinable
   @inline(__always)
   internal mutating func removeSubrange<R: RangeExpression>(
     _ bounds: R
   ) where R.Bound == Index {
-    // TODO: optimize to not perform excessive traversals
     let bounds = bounds.relative(to: self)
     
     bounds.upperBound._index.ensureValid(forTree: self._root)
@@ -85,10 +85,34 @@ extension SortedSet: SetAlgebra {
   /// - Returns: A new sorted set with the unique elements of this set and `other`.
   /// - Note: if this set and `other` contain elements that are equal but
   ///   distinguishable (e.g. via `===`), the element from the second set is inserted.
-  /// - Complexity: O(`self.count` + `other.count`)
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public func union(_ other: __owned Self) -> Self {
-    var builder = _Tree.Builder(deduplicating: true)
+    // If one of the sets is much smaller, insert its members into (a copy of)
+    // the other one instead of rebuilding the whole tree.
+    if Self._prefersSearching(other.count, in: self.count) {
+      var result = self
+      for element in other {
+        result.update(with: element)
+      }
+      return result
+    }
+    if Self._prefersSearching(self.count, in: other.count),
+       _hasSameNodeCapacities(as: other) {
+      var result = other
+      for element in self {
+        result.insert(element)
+      }
+      return result
+    }
+
+    var builder = _Tree.Builder(
+      deduplicating: true,
+      leafCapacity: _root.leafCapacity,
+      internalCapacity: _root.internalCapacity
+    )
      
     var it1 = self.makeIterator()
     var it2 = other.makeIterator()
@@ -125,7 +149,9 @@ extension SortedSet: SetAlgebra {
   /// - Parameter other: A set of the same type as the current set.
   /// - Note: if this set and `other` contain elements that are equal but
   ///   distinguishable (e.g. via `===`), the element from the second set is inserted.
-  /// - Complexity: O(`self.count` + `other.count`)
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public mutating func formUnion(_ other: __owned Self) {
     self = union(other)
@@ -139,12 +165,32 @@ extension SortedSet: SetAlgebra {
   /// - Note: if this set and `other` contain elements that are equal but
   ///   distinguishable (e.g. via `===`), which of these elements is present
   ///   in the result is unspecified.
-  /// - Complexity: O(`self.count` + `other.count`)
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public func intersection(_ other: Self) -> Self {
-    // We'll run this such that 'self' is the smallest array
     // TODO: might want to consider uniqueness to minimize CoW copies.
-    var builder = _Tree.Builder(deduplicating: true)
+    var builder = _Tree.Builder(
+      deduplicating: true,
+      leafCapacity: _root.leafCapacity,
+      internalCapacity: _root.internalCapacity
+    )
+    
+    // If one of the sets is much smaller, look up each of its members in the
+    // other one instead of walking through both.
+    if Self._prefersSearching(self.count, in: other.count) {
+      for element in self where other.contains(element) {
+        builder.append(element)
+      }
+      return SortedSet(_rootedAt: builder.finish())
+    }
+    if Self._prefersSearching(other.count, in: self.count) {
+      for element in other where self.contains(element) {
+        builder.append(element)
+      }
+      return SortedSet(_rootedAt: builder.finish())
+    }
     
     var it1 = self.makeIterator()
     var it2 = other.makeIterator()
@@ -175,7 +221,9 @@ extension SortedSet: SetAlgebra {
   /// - Note: if this set and `other` contain elements that are equal but
   ///   distinguishable (e.g. via `===`), which of these elements is present
   ///   in the result is unspecified.
-  /// - Complexity: O(`self.count` + `other.count`)
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public mutating func formIntersection(_ other: Self) {
     self = intersection(other)
@@ -186,10 +234,24 @@ extension SortedSet: SetAlgebra {
   ///
   /// - Parameter other: A set of the same type as the current set.
   /// - Returns: A new set.
-  /// - Complexity: O(`self.count` + `other.count`)
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public func symmetricDifference(_ other: Self) -> Self {
-    var builder = _Tree.Builder(deduplicating: true)
+    if Self._prefersSearching(other.count, in: self.count) {
+      return self._toggling(other)
+    }
+    if Self._prefersSearching(self.count, in: other.count),
+       _hasSameNodeCapacities(as: other) {
+      return other._toggling(self)
+    }
+
+    var builder = _Tree.Builder(
+      deduplicating: true,
+      leafCapacity: _root.leafCapacity,
+      internalCapacity: _root.internalCapacity
+    )
     
     var it1 = self.makeIterator()
     var it2 = other.makeIterator()
@@ -229,7 +291,9 @@ extension SortedSet: SetAlgebra {
   /// the members of the given set that are not already in the set.
   ///
   /// - Parameter other: A set of the same type.
-  /// - Complexity: O(`self.count` + `other.count`)
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public mutating func formSymmetricDifference(_ other: Self) {
     self = self.symmetricDifference(other)
@@ -240,10 +304,31 @@ extension SortedSet: SetAlgebra {
   ///
   /// - Parameter other: A set of the same type as the current set.
   /// - Returns: A new set.
-  /// - Complexity: O(`self.count` + `other.count`)
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public func subtracting(_ other: Self) -> Self {
-    var builder = _Tree.Builder(deduplicating: true)
+    if Self._prefersSearching(other.count, in: self.count) {
+      var result = self
+      for element in other {
+        result.remove(element)
+      }
+      return result
+    }
+    
+    var builder = _Tree.Builder(
+      deduplicating: true,
+      leafCapacity: _root.leafCapacity,
+      internalCapacity: _root.internalCapacity
+    )
+    
+    if Self._prefersSearching(self.count, in: other.count) {
+      for element in self where !other.contains(element) {
+        builder.append(element)
+      }
+      return SortedSet(_rootedAt: builder.finish())
+    }
     
     var it1 = self.makeIterator()
     var it2 = other.makeIterator()
@@ -276,7 +361,9 @@ extension SortedSet: SetAlgebra {
   /// Removes the elements of the given set from this set.
   ///
   /// - Parameter other: A set of the same type as the current set.
-  /// - Complexity: O(`self.count` + `other.count`)
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public mutating func subtract(_ other: SortedSet<Element>) {
     self = self.subtracting(other)
@@ -289,17 +376,20 @@ extension SortedSet: SetAlgebra {
   ///
   /// - Parameter other: A set of the same type as the current set.
   /// - Returns: `true` if the set is a subset of other; otherwise, `false`.
-  /// - Complexity: O(max(`self.count`, `other.count`))
+  /// - Complexity: O(max(`self.count`, `other.count`)), or
+  ///   O(`self.count` * log(`other.count`)) if `self` is much smaller than
+  ///   `other`.
   @inlinable
   public func isSubset(of other: SortedSet<Element>) -> Bool {
     // TODO: could be worthwhile to evaluate recursive approach
-    // TODO: in some cases, it could be faster to search from the root each time
-    // Searching from the root is faster when:
-    //    self.count < other.count / (log(other.count) - 1)
-    // This means when `other` is significantly larger than `self`, it may be
-    // faster to search from the root each time.
     if self.count > other.count { return false }
     
+    // When `other` is significantly larger than `self`, it is faster to
+    // search from the root each time.
+    if Self._prefersSearching(self.count, in: other.count) {
+      return self.allSatisfy { other.contains($0) }
+    }
+    
     var superIterator = other.makeIterator()
     
     for element in self {
@@ -344,9 +434,18 @@ extension SortedSet: SetAlgebra {
   /// - Parameter other: A set of the same type as the current set.
   /// - Returns: `true` if the set has no elements in common with `other`;
   ///   otherwise, `false`.
-  /// - Complexity: O(`self.count` + `other.count`).
+  /// - Complexity: O(`self.count` + `other.count`), or O(*k* log *n*) if
+  ///   one of the two sets has *k* members and is much smaller than the
+  ///   other one, which has *n* members.
   @inlinable
   public func isDisjoint(with other: SortedSet<Element>) -> Bool {
+    if Self._prefersSearching(self.count, in: other.count) {
+      return !self.contains(where: { other.contains($0) })
+    }
+    if Self._prefersSearching(other.count, in: self.count) {
+      return !other.contains(where: { self.contains($0) })
+    }
+    
     var it1 = self.makeIterator()
     var it2 = other.makeIterator()
     
@@ -368,3 +467,46 @@ extension SortedSet: SetAlgebra {
     return true
   }
 }
+
+extension SortedSet {
+  /// Returns true if it is cheaper to look up each of `k` members in a set of
+  /// `n` members than to walk through both sets in lockstep.
+  ///
+  /// A lookup costs O(log `n`) comparisons, so searching wins once
+  /// `k * log(n)` drops below `k + n`. The cutoff is conservative, as each
+  /// lookup also has worse locality than a sequential scan.
+  @inlinable
+  @inline(__always)
+  internal static func _prefersSearching(_ k: Int, in n: Int) -> Bool {
+    let logN = Int.bitWidth &- n.leadingZeroBitCount
+    return k &* logN < n
+  }
+
+  /// Returns true if the trees of both sets use the same node capacities.
+  ///
+  /// Results derived from `self` must keep its node capacities, so a copy of
+  /// `other` may only stand in for `self` when this is the case.
+  @inlinable
+  @inline(__always)
+  internal func _hasSameNodeCapacities(as other: Self) -> Bool {
+    _root.leafCapacity == other._root.leafCapacity &&
+      _root.internalCapacity == other._root.internalCapacity
+  }
+
+  /// Returns a copy of this set where each member of `other` is removed if it
+  /// was present and inserted otherwise.
+  ///
+  /// - Complexity: O(`other.count` * log(`self.count`)). The copy shares
+  ///   storage with `self`, so only the nodes along the modified paths get
+  ///   copied.
+  @inlinable
+  internal func _toggling(_ other: Self) -> Self {
+    var result = self
+    for element in other {
+      if result.remove(element) == nil {
+        result.insert(element)
+      }
+    }
+    return result
+  }
+}
@@ -29,6 +29,37 @@ public struct SortedSet<Element: Comparable> {
     self._root = _Tree()
   }
   
+  /// Creates an empty set whose underlying B-tree nodes hold the specified
+  /// numbers of elements.
+  ///
+  /// By default, nodes are sized to a small number of elements based on the
+  /// size of `Element`. Larger nodes make for shallower trees with fewer
+  /// allocations, which speeds up lookups and iteration over large sets, at
+  /// the cost of moving more elements around on each insertion and removal.
+  ///
+  /// The capacities apply to the lifetime of the set, including any copies
+  /// of it, and sets derived from it by operations such as `union(_:)`.
+  ///
+  /// - Parameters:
+  ///   - leafCapacity: The maximum number of elements in a leaf node. This
+  ///      must be between 4 and 65534.
+  ///   - internalCapacity: The maximum number of elements in an internal
+  ///      node. This must be between 4 and 65534. Very small internal
+  ///      capacities limit the size of the set, as its tree can be at most
+  ///      16 levels deep: with a capacity of 4, it can hold tens of millions
+  ///      of elements.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public init(leafCapacity: Int, internalCapacity: Int) {
+    _Tree._checkCapacities(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity)
+    self._root = _Tree(
+      leafCapacity: leafCapacity,
+      internalCapacity: internalCapacity)
+  }
+  
   /// Creates a set rooted at a given B-Tree.
   @inlinable
   internal init(_rootedAt tree: _Tree) {
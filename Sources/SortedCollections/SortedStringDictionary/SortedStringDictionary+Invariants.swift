@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+
+extension SortedStringDictionary {
+  #if COLLECTIONS_INTERNAL_CHECKS
+  /// Whether `left` orders before `right`.
+  fileprivate func _less(_ left: _Node.Bytes, _ right: _Node.Bytes) -> Bool {
+    left.withUnsafeBufferPointer { left in
+      right.withUnsafeBufferPointer { right in
+        _Node._compare(left, right) < 0
+      }
+    }
+  }
+
+  @inline(never)
+  @usableFromInline
+  internal func _checkInvariants() {
+    _root._checkInvariants(isRoot: true) { leaf, lowerBound, upperBound in
+      precondition(leaf.suffixEnds.count == leaf.count, "Invalid leaf count.")
+      precondition(Int(leaf.suffixEnds.last ?? 0) == leaf.suffixBytes.count,
+                   "Suffixes don't span the entire arena.")
+      var previous: _Node.Bytes? = nil
+      for slot in leaf.suffixEnds.indices {
+        precondition(
+          slot == 0 || leaf.suffixEnds[slot - 1] <= leaf.suffixEnds[slot],
+          "Suffix offsets out of order.")
+        let key = leaf._key(atSlot: slot)
+        if let previous = previous {
+          precondition(_less(previous, key), "Node keys out of order.")
+        }
+        if let lowerBound = lowerBound {
+          precondition(!_less(key, lowerBound), "Key below its separator.")
+        }
+        if let upperBound = upperBound {
+          precondition(_less(key, upperBound), "Key above its separator.")
+        }
+        previous = key
+      }
+    }
+  }
+  #else
+  @inlinable
+  @inline(__always)
+  internal func _checkInvariants() {}
+  #endif // COLLECTIONS_INTERNAL_CHECKS
+}
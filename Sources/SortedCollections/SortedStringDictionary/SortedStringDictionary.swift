@@ -0,0 +1,167 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A sorted dictionary with string keys, which stores the keys of each of its
+/// leaves compactly by factoring out the prefix they share.
+///
+/// Large sets of strings such as file paths or URLs tend to share long
+/// prefixes. A `SortedDictionary<String, Value>` stores each of its keys as a
+/// separate `String`, so these prefixes are repeated in every key. Instead,
+/// each leaf of a sorted string dictionary stores the UTF-8 bytes its keys
+/// have in common once, followed by the remaining bytes of all of its keys
+/// back to back in a single buffer:
+///
+///     var sizes: SortedStringDictionary<Int> = [:]
+///     sizes["/usr/share/doc/a.txt"] = 120
+///     sizes["/usr/share/doc/b.txt"] = 4096
+///     // Stored as "/usr/share/doc/" followed by "a.txt" and "b.txt".
+///
+/// Lookups compare raw UTF-8 bytes rather than `String` values, and only look
+/// at the bytes following the prefix of the leaf, which are contiguous in
+/// memory.
+///
+/// - Important: Keys are ordered by their UTF-8 encoding, that is, by their
+///     Unicode scalar values. Unlike `String` comparisons, this does not take
+///     canonical equivalence into account, so `"caf\u{E9}"` and
+///     `"cafe\u{301}"` are distinct keys.
+public struct SortedStringDictionary<Value> {
+  /// The type of the keys in the dictionary.
+  public typealias Key = String
+
+  /// An element of the dictionary. A key-value tuple.
+  public typealias Element = (key: Key, value: Value)
+
+  @usableFromInline
+  internal typealias _Node = _StringKeyNode<Value>
+
+  @usableFromInline
+  internal var _root: _Node
+
+  /// Creates an empty dictionary.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public init() {
+    self._root = _Node()
+  }
+
+  /// Creates a dictionary from a sequence of key-value pairs.
+  ///
+  /// If duplicates are encountered the last instance of the key-value pair is
+  /// the one that is kept.
+  ///
+  /// - Parameter keysAndValues: A sequence of key-value pairs to use for the
+  ///     new dictionary.
+  /// - Complexity: O(`n log n`) where `n` is the number of key-value pairs in
+  ///   `keysAndValues`.
+  @inlinable
+  public init<S: Sequence>(
+    keysWithValues keysAndValues: __owned S
+  ) where S.Element == (Key, Value) {
+    self.init()
+    for (key, value) in keysAndValues {
+      self.updateValue(value, forKey: key)
+    }
+  }
+}
+
+// MARK: Accessing Keys and Values
+extension SortedStringDictionary {
+  /// The number of key-value pairs in the dictionary.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  @inline(__always)
+  public var count: Int { _root.count }
+
+  /// A Boolean value that indicates whether the dictionary is empty.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  @inline(__always)
+  public var isEmpty: Bool { _root.count == 0 }
+
+  /// Accesses the value associated with the given key for reading and
+  /// writing.
+  ///
+  /// Assigning `nil` removes the key and its associated value from the
+  /// dictionary.
+  ///
+  /// - Parameter key: The key to find in the dictionary.
+  /// - Returns: The value associated with `key` if `key` is in the
+  ///     dictionary; otherwise, `nil`.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the dictionary.
+  @inlinable
+  public subscript(key: Key) -> Value? {
+    get {
+      _Node._withUTF8(key) { _root._value(forKey: $0) }
+    }
+    set {
+      if let newValue = newValue {
+        updateValue(newValue, forKey: key)
+      } else {
+        removeValue(forKey: key)
+      }
+    }
+  }
+
+  /// Updates the value stored in the dictionary for the given key, or
+  /// inserts a new key-value pair if the key does not exist.
+  ///
+  /// - Parameters:
+  ///   - value: The new value to add to the dictionary.
+  ///   - key: The key to associate with `value`.
+  /// - Returns: The value that was replaced, or `nil` if a new key-value pair
+  ///     was added.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func updateValue(
+    _ value: __owned Value,
+    forKey key: Key
+  ) -> Value? {
+    defer { _checkInvariants() }
+    return _Node._withUTF8(key) { key in
+      _Node._updateValue(value, forKey: key, inRoot: &_root)
+    }
+  }
+
+  /// Removes the given key and its associated value from the dictionary.
+  ///
+  /// - Parameter key: The key to remove along with its associated value.
+  /// - Returns: The value that was removed, or `nil` if the key was not
+  ///     present in the dictionary.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func removeValue(forKey key: Key) -> Value? {
+    defer { _checkInvariants() }
+    return _Node._withUTF8(key) { key in
+      _Node._removeValue(forKey: key, inRoot: &_root)
+    }
+  }
+}
+
+extension SortedStringDictionary: ExpressibleByDictionaryLiteral {
+  /// Creates a new sorted string dictionary from the contents of a
+  /// dictionary literal.
+  ///
+  /// - Parameter elements: A variadic list of key-value pairs for the new
+  ///    dictionary.
+  /// - Complexity: O(`n log n`)
+  @inlinable
+  public init(dictionaryLiteral elements: (Key, Value)...) {
+    self.init(keysWithValues: elements)
+  }
+}
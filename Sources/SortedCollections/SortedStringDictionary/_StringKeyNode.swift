@@ -0,0 +1,479 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A node in the B+ tree backing a ``SortedStringDictionary``.
+///
+/// Key-value pairs are only stored in leaves. A leaf stores the UTF-8 bytes
+/// that all of its keys begin with once, in `prefix`, and the remaining bytes
+/// of each key back to back in a single arena, `suffixBytes`. The suffix of
+/// the key in `slot` spans from `suffixEnds[slot - 1]` (or zero) up to
+/// `suffixEnds[slot]`.
+///
+/// Internal nodes route lookups with the UTF-8 bytes of separator keys, as
+/// described by ``_BPlusTreeNode``. Separators are only as long as needed to
+/// tell apart the two children they fall between.
+@usableFromInline
+internal final class _StringKeyNode<Value> {
+  @usableFromInline
+  internal typealias Bytes = ContiguousArray<UInt8>
+
+  /// The bytes that the UTF-8 encoding of every key in a leaf starts with.
+  ///
+  /// This is a common prefix of the keys, but not necessarily the longest
+  /// one: it is only extended when the leaf is split or merged.
+  @usableFromInline
+  internal var prefix: Bytes
+
+  /// The UTF-8 bytes of the keys of a leaf following `prefix`, back to back.
+  @usableFromInline
+  internal var suffixBytes: Bytes
+
+  /// The offset in `suffixBytes` at which the suffix of each key of a leaf
+  /// ends.
+  @usableFromInline
+  internal var suffixEnds: ContiguousArray<UInt32>
+
+  /// The values of a leaf. Always empty for internal nodes.
+  @usableFromInline
+  internal var values: ContiguousArray<Value>
+
+  /// The keys separating the children of an internal node.
+  @usableFromInline
+  internal var separators: ContiguousArray<Bytes>
+
+  /// The children of an internal node. Always empty for leaves.
+  @usableFromInline
+  internal var children: ContiguousArray<_StringKeyNode>
+
+  @usableFromInline
+  internal let isLeaf: Bool
+
+  /// The number of key-value pairs in this subtree.
+  @usableFromInline
+  internal var count: Int
+
+  @inlinable
+  internal init(
+    isLeaf: Bool,
+    prefix: Bytes,
+    suffixBytes: Bytes,
+    suffixEnds: ContiguousArray<UInt32>,
+    values: ContiguousArray<Value>,
+    separators: ContiguousArray<Bytes>,
+    children: ContiguousArray<_StringKeyNode>,
+    count: Int
+  ) {
+    self.isLeaf = isLeaf
+    self.prefix = prefix
+    self.suffixBytes = suffixBytes
+    self.suffixEnds = suffixEnds
+    self.values = values
+    self.separators = separators
+    self.children = children
+    self.count = count
+  }
+
+  /// Creates an empty leaf.
+  @inlinable
+  internal convenience init() {
+    self.init(
+      isLeaf: true,
+      prefix: [],
+      suffixBytes: [],
+      suffixEnds: [],
+      values: [],
+      separators: [],
+      children: [],
+      count: 0)
+  }
+
+  /// Creates an internal node with the given children and separators.
+  @inlinable
+  internal convenience init(
+    children: ContiguousArray<_StringKeyNode>,
+    separators: ContiguousArray<Bytes>
+  ) {
+    assert(separators.count == children.count - 1)
+    self.init(
+      isLeaf: false,
+      prefix: [],
+      suffixBytes: [],
+      suffixEnds: [],
+      values: [],
+      separators: separators,
+      children: children,
+      count: children.reduce(0) { $0 + $1.count })
+  }
+
+  /// Returns a copy of this node that shares its children with it.
+  @inlinable
+  internal func copy() -> _StringKeyNode {
+    _StringKeyNode(
+      isLeaf: isLeaf,
+      prefix: prefix,
+      suffixBytes: suffixBytes,
+      suffixEnds: suffixEnds,
+      values: values,
+      separators: separators,
+      children: children,
+      count: count)
+  }
+}
+
+extension _StringKeyNode: _BPlusTreeNode {
+  @usableFromInline
+  internal typealias SearchKey = UnsafeBufferPointer<UInt8>
+
+  @usableFromInline
+  internal typealias Separator = Bytes
+
+  /// The maximum number of key-value pairs in a leaf.
+  @inlinable
+  @inline(__always)
+  internal static var leafCapacity: Int {
+    #if DEBUG
+    return 4
+    #else
+    return 64
+    #endif
+  }
+
+  /// The maximum number of children of an internal node.
+  @inlinable
+  @inline(__always)
+  internal static var internalCapacity: Int {
+    #if DEBUG
+    return 4
+    #else
+    return 32
+    #endif
+  }
+
+  /// Nodes don't cache anything beyond their count.
+  @inlinable
+  @inline(__always)
+  internal func _didUpdate() {}
+}
+
+// MARK: Byte Comparisons
+extension _StringKeyNode {
+  /// Calls the given closure with the UTF-8 bytes of a string.
+  @inlinable
+  @inline(__always)
+  internal static func _withUTF8<R>(
+    _ key: String,
+    _ body: (UnsafeBufferPointer<UInt8>) throws -> R
+  ) rethrows -> R {
+    var key = key
+    return try key.withUTF8(body)
+  }
+
+  /// Compares two byte sequences lexicographically.
+  ///
+  /// - Returns: A negative value if `left` orders before `right`, zero if they
+  ///     are equal, or a positive value otherwise.
+  @inlinable
+  internal static func _compare(
+    _ left: UnsafeBufferPointer<UInt8>,
+    _ right: UnsafeBufferPointer<UInt8>
+  ) -> Int {
+    let length = Swift.min(left.count, right.count)
+    var i = 0
+    while i < length {
+      let l = left[i]
+      let r = right[i]
+      if l != r { return l < r ? -1 : 1 }
+      i &+= 1
+    }
+    return left.count &- right.count
+  }
+
+  /// Returns the number of leading bytes that two byte sequences share.
+  @inlinable
+  internal static func _commonPrefixLength<L: Collection, R: Collection>(
+    _ left: L,
+    _ right: R
+  ) -> Int where L.Element == UInt8, R.Element == UInt8 {
+    var length = 0
+    for (l, r) in zip(left, right) {
+      if l != r { break }
+      length &+= 1
+    }
+    return length
+  }
+}
+
+// MARK: Leaf Contents
+extension _StringKeyNode {
+  /// Calls the given closure with the bytes of the key in the given slot of a
+  /// leaf that follow its prefix.
+  @inlinable
+  @inline(__always)
+  internal func _withSuffix<R>(
+    atSlot slot: Int,
+    _ body: (UnsafeBufferPointer<UInt8>) throws -> R
+  ) rethrows -> R {
+    let start = slot == 0 ? 0 : Int(suffixEnds[slot &- 1])
+    let end = Int(suffixEnds[slot])
+    return try suffixBytes.withUnsafeBufferPointer { bytes in
+      try body(UnsafeBufferPointer(rebasing: bytes[start ..< end]))
+    }
+  }
+
+  /// Returns the UTF-8 bytes of the key in the given slot of a leaf.
+  @inlinable
+  internal func _key(atSlot slot: Int) -> Bytes {
+    var key = prefix
+    _withSuffix(atSlot: slot) { key.append(contentsOf: $0) }
+    return key
+  }
+
+  /// Returns the key in the given slot of a leaf.
+  @inlinable
+  internal func _string(atSlot slot: Int) -> String {
+    String(decoding: _key(atSlot: slot), as: UTF8.self)
+  }
+
+  /// Finds the first slot of a leaf whose key is greater than or equal to the
+  /// given one.
+  ///
+  /// Keys that don't start with the leaf's prefix order before or after every
+  /// key in the leaf, so only the remaining keys are compared with the
+  /// suffixes in the arena.
+  ///
+  /// - Returns: The slot, and whether the key in it equals `key`.
+  @inlinable
+  internal func _leafSlot(
+    forKey key: UnsafeBufferPointer<UInt8>
+  ) -> (slot: Int, isFound: Bool) {
+    let slotCount = suffixEnds.count
+    if slotCount == 0 { return (0, false) }
+
+    let prefixLength = prefix.count
+    let order = prefix.withUnsafeBufferPointer { prefix in
+      Self._compare(UnsafeBufferPointer(rebasing: key.prefix(prefixLength)), prefix)
+    }
+    if order < 0 { return (0, false) }
+    if order > 0 { return (slotCount, false) }
+
+    let rest = UnsafeBufferPointer(rebasing: key[prefixLength...])
+    return suffixBytes.withUnsafeBufferPointer { bytes in
+      suffixEnds.withUnsafeBufferPointer { ends in
+        var start = 0
+        var end = slotCount
+        var isFound = false
+        while start < end {
+          let mid = start &+ (end &- start) / 2
+          let suffixStart = mid == 0 ? 0 : Int(ends[mid &- 1])
+          let suffix = UnsafeBufferPointer(
+            rebasing: bytes[suffixStart ..< Int(ends[mid])])
+          let order = Self._compare(suffix, rest)
+          if order < 0 {
+            start = mid &+ 1
+          } else {
+            end = mid
+            isFound = order == 0
+          }
+        }
+        return (start, isFound)
+      }
+    }
+  }
+
+  /// Returns the slot of the child of an internal node that would contain
+  /// `key`.
+  @inlinable
+  internal func _childSlot(forKey key: UnsafeBufferPointer<UInt8>) -> Int {
+    var start = 0
+    var end = separators.count
+    while start < end {
+      let mid = start &+ (end &- start) / 2
+      let order = separators[mid].withUnsafeBufferPointer {
+        Self._compare($0, key)
+      }
+      if order <= 0 {
+        start = mid &+ 1
+      } else {
+        end = mid
+      }
+    }
+    return start
+  }
+
+  /// Moves the last bytes of the prefix of a leaf to the front of each of its
+  /// suffixes, so that the prefix has the given length.
+  @inlinable
+  internal func _shortenPrefix(to length: Int) {
+    let moved = prefix[length...]
+    if moved.isEmpty { return }
+
+    var bytes = Bytes()
+    bytes.reserveCapacity(suffixBytes.count + suffixEnds.count * moved.count)
+    var start = 0
+    for slot in suffixEnds.indices {
+      let end = Int(suffixEnds[slot])
+      bytes.append(contentsOf: moved)
+      bytes.append(contentsOf: suffixBytes[start ..< end])
+      suffixEnds[slot] = UInt32(bytes.count)
+      start = end
+    }
+    suffixBytes = bytes
+    prefix.removeSubrange(length...)
+  }
+
+  /// Extends the prefix of a leaf to the longest prefix its keys have in
+  /// common, removing it from each of its suffixes.
+  ///
+  /// As keys are sorted, this is the common prefix of the first and last keys.
+  @inlinable
+  internal func _extendPrefix() {
+    let slotCount = suffixEnds.count
+    if slotCount == 0 { return }
+
+    var extra = 0
+    _withSuffix(atSlot: 0) { first in
+      _withSuffix(atSlot: slotCount &- 1) { last in
+        extra = Self._commonPrefixLength(first, last)
+      }
+      prefix.append(contentsOf: first.prefix(extra))
+    }
+    if extra == 0 { return }
+
+    var bytes = Bytes()
+    bytes.reserveCapacity(suffixBytes.count - slotCount * extra)
+    var start = 0
+    for slot in suffixEnds.indices {
+      let end = Int(suffixEnds[slot])
+      bytes.append(contentsOf: suffixBytes[(start + extra) ..< end])
+      suffixEnds[slot] = UInt32(bytes.count)
+      start = end
+    }
+    suffixBytes = bytes
+  }
+
+  /// Inserts a key-value pair into the given slot of a leaf, shortening the
+  /// leaf's prefix if the key doesn't start with it.
+  ///
+  /// - Warning: This does not update the count of the node.
+  @inlinable
+  internal func _insert(
+    _ value: __owned Value,
+    forKey key: UnsafeBufferPointer<UInt8>,
+    atSlot slot: Int
+  ) {
+    if suffixEnds.isEmpty {
+      prefix = Bytes(key)
+      suffixBytes = []
+      suffixEnds = [0]
+      values = [value]
+      return
+    }
+
+    let shared = Self._commonPrefixLength(prefix, key)
+    if shared < prefix.count {
+      _shortenPrefix(to: shared)
+    }
+
+    let rest = key[shared...]
+    let offset = slot == 0 ? 0 : Int(suffixEnds[slot &- 1])
+    let length = UInt32(rest.count)
+    suffixBytes.insert(contentsOf: rest, at: offset)
+    for i in slot ..< suffixEnds.count {
+      suffixEnds[i] += length
+    }
+    suffixEnds.insert(UInt32(offset) + length, at: slot)
+    values.insert(value, at: slot)
+  }
+
+  /// Removes the key-value pair in the given slot of a leaf.
+  ///
+  /// - Warning: This does not update the count of the node.
+  @inlinable
+  internal func _remove(atSlot slot: Int) -> Value {
+    let start = slot == 0 ? 0 : Int(suffixEnds[slot &- 1])
+    let end = Int(suffixEnds[slot])
+    let length = UInt32(end - start)
+    suffixBytes.removeSubrange(start ..< end)
+    suffixEnds.remove(at: slot)
+    for i in slot ..< suffixEnds.count {
+      suffixEnds[i] -= length
+    }
+    if suffixEnds.isEmpty {
+      prefix = []
+    }
+    return values.remove(at: slot)
+  }
+
+  /// Appends the key-value pairs of another leaf, whose keys must all be
+  /// greater than the keys of this one, then extends the prefix to cover
+  /// the keys of both.
+  ///
+  /// - Warning: This does not update the count of the node.
+  @inlinable
+  internal func _appendLeaf(_ other: _StringKeyNode) {
+    let shared = Self._commonPrefixLength(prefix, other.prefix)
+    _shortenPrefix(to: shared)
+
+    let moved = other.prefix[shared...]
+    suffixBytes.reserveCapacity(
+      suffixBytes.count + other.suffixBytes.count
+        + other.suffixEnds.count * moved.count)
+    var start = 0
+    for slot in other.suffixEnds.indices {
+      let end = Int(other.suffixEnds[slot])
+      suffixBytes.append(contentsOf: moved)
+      suffixBytes.append(contentsOf: other.suffixBytes[start ..< end])
+      suffixEnds.append(UInt32(suffixBytes.count))
+      start = end
+    }
+    values.append(contentsOf: other.values)
+    _extendPrefix()
+  }
+
+  /// Moves the key-value pairs of a leaf from the given slot onwards into a
+  /// new leaf, and returns it along with the separator between the two.
+  ///
+  /// - Warning: This does not update the count of the current node.
+  @inlinable
+  internal func _splitLeaf(
+    at mid: Int
+  ) -> (separator: Bytes, node: _StringKeyNode) {
+    // The shortest separator is the start of the right node's first key,
+    // up to and including the first byte where it differs from the left
+    // node's last key.
+    var separator = prefix
+    _withSuffix(atSlot: mid &- 1) { last in
+      _withSuffix(atSlot: mid) { first in
+        let shared = Self._commonPrefixLength(last, first)
+        separator.append(contentsOf: first.prefix(shared &+ 1))
+      }
+    }
+
+    let offset = Int(suffixEnds[mid &- 1])
+    let right = _StringKeyNode(
+      isLeaf: true,
+      prefix: prefix,
+      suffixBytes: Bytes(suffixBytes[offset...]),
+      suffixEnds: ContiguousArray(
+        suffixEnds[mid...].lazy.map { $0 - UInt32(offset) }),
+      values: ContiguousArray(values[mid...]),
+      separators: [],
+      children: [],
+      count: suffixEnds.count - mid)
+    suffixBytes.removeSubrange(offset...)
+    suffixEnds.removeSubrange(mid...)
+    values.removeSubrange(mid...)
+
+    self._extendPrefix()
+    right._extendPrefix()
+    return (separator, right)
+  }
+}
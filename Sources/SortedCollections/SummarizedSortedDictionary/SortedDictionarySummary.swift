@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A monoid that summarizes a run of consecutive key-value pairs in a
+/// ``SummarizedSortedDictionary``.
+///
+/// A summarized sorted dictionary caches the summary of every subtree in its
+/// underlying tree, which lets it combine the summary of any range of keys
+/// out of the cached summaries of O(log *n*) nodes and their children.
+/// Conforming types describe how to summarize a single key-value pair, and
+/// how to combine the summaries of two adjacent runs:
+///
+///     struct Total: SortedDictionarySummary {
+///       var sum: Double
+///
+///       static var zero: Total { Total(sum: 0) }
+///
+///       init(sum: Double) { self.sum = sum }
+///       init(key: Date, value: Double) { self.sum = value }
+///
+///       mutating func add(_ other: Total) { sum += other.sum }
+///     }
+///
+/// Unlike `RopeSummary`, summaries don't need to be commutative or
+/// invertible: minimums, maximums, and "first/last seen" values are all
+/// valid summaries. However, `add(_:)` must be associative, and `zero` must
+/// be its identity element.
+public protocol SortedDictionarySummary {
+  /// The type of the keys in the summarized dictionary.
+  associatedtype Key: Comparable
+
+  /// The type of the values in the summarized dictionary.
+  associatedtype Value
+
+  /// The summary of an empty run of key-value pairs. This must be the
+  /// identity element of `add(_:)`.
+  static var zero: Self { get }
+
+  /// Creates the summary of a single key-value pair.
+  init(key: Key, value: Value)
+
+  /// Combines `self` with the summary of a run of key-value pairs that
+  /// immediately follows the one summarized by `self`.
+  ///
+  /// This operation must be associative.
+  mutating func add(_ other: Self)
+}
+
+extension SortedDictionarySummary {
+  /// Returns the combination of `self` with the summary of a run of key-value
+  /// pairs that immediately follows the one summarized by `self`.
+  @inlinable
+  public func adding(_ other: Self) -> Self {
+    var c = self
+    c.add(other)
+    return c
+  }
+}
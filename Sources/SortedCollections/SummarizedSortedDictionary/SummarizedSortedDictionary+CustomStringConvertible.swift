@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension SummarizedSortedDictionary: CustomStringConvertible, CustomDebugStringConvertible {
+  @inlinable
+  public var description: String {
+    _sortedDictionaryDescription(for: self)
+  }
+
+  @inlinable
+  public var debugDescription: String {
+    _sortedDictionaryDebugDescription(
+      for: self, typeName: "SummarizedSortedDictionary<\(Summary.self)>")
+  }
+}
@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+
+extension SummarizedSortedDictionary {
+  #if COLLECTIONS_INTERNAL_CHECKS
+  @inline(never)
+  @usableFromInline
+  internal func _checkInvariants() {
+    _root._checkInvariants(isRoot: true) { leaf, lowerBound, upperBound in
+      precondition(leaf.keys.count == leaf.count, "Invalid leaf count.")
+      for slot in leaf.keys.indices.dropFirst() {
+        precondition(leaf.keys[slot - 1] < leaf.keys[slot],
+                     "Node keys out of order.")
+      }
+      if let lowerBound = lowerBound, let first = leaf.keys.first {
+        precondition(lowerBound <= first, "Key below its separator.")
+      }
+      if let upperBound = upperBound, let last = leaf.keys.last {
+        precondition(last < upperBound, "Key above its separator.")
+      }
+    }
+  }
+  #else
+  @inlinable
+  @inline(__always)
+  internal func _checkInvariants() {}
+  #endif // COLLECTIONS_INTERNAL_CHECKS
+}
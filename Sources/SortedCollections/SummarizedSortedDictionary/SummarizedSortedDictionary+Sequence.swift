@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+extension SummarizedSortedDictionary: Sequence {
+  /// An iterator over the key-value pairs of a summarized sorted dictionary,
+  /// in ascending order of their keys.
+  @frozen
+  public struct Iterator: IteratorProtocol {
+    @usableFromInline
+    internal var _base: _BPlusTreeIterator<_Node>
+
+    @inlinable
+    internal init(_root: _Node) {
+      self._base = _BPlusTreeIterator(root: _root)
+    }
+
+    /// Advances to the next key-value pair and returns it, or `nil` if no
+    /// next element exists.
+    ///
+    /// - Complexity: O(1) amortized.
+    @inlinable
+    public mutating func next() -> Element? {
+      guard let next = _base.next() else { return nil }
+      return (next.leaf.keys[next.slot], next.leaf.values[next.slot])
+    }
+  }
+
+  /// Returns an iterator over the key-value pairs of the dictionary.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public __consuming func makeIterator() -> Iterator {
+    Iterator(_root: _root)
+  }
+
+  @inlinable
+  public var underestimatedCount: Int { count }
+}
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+
+extension SummarizedSortedDictionary {
+  /// The summary of all key-value pairs in the dictionary.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public var summary: Summary { _root.summary }
+
+  /// Returns the summary of the key-value pairs whose keys fall within the
+  /// given range.
+  ///
+  ///     let d: SummarizedSortedDictionary<Total> = [1: 10, 2: 20, 3: 30]
+  ///     d.summary(of: 2 ..< 4).sum // 50
+  ///
+  /// Subtrees that lie entirely within the range contribute their cached
+  /// summaries, so only the nodes along the paths to the two bounds of the
+  /// range are visited.
+  ///
+  /// - Parameter keys: The range of keys to summarize. The bounds of the
+  ///     range don't need to be present in the dictionary.
+  /// - Complexity: O(`log n`) node visits and O(*B* `log n`) calls to
+  ///   `SortedDictionarySummary.add(_:)`, where `n` is the number of
+  ///   key-value pairs in the dictionary and *B* is the maximum number of
+  ///   entries in a node.
+  @inlinable
+  public func summary(of keys: Range<Key>) -> Summary {
+    _root.summary(
+      from: (key: keys.lowerBound, isInclusive: true),
+      to: (key: keys.upperBound, isInclusive: false))
+  }
+
+  /// Returns the summary of the key-value pairs whose keys fall within the
+  /// given range.
+  ///
+  /// - Complexity: O(`log n`) node visits and O(*B* `log n`) calls to
+  ///   `SortedDictionarySummary.add(_:)`, where `n` is the number of
+  ///   key-value pairs in the dictionary and *B* is the maximum number of
+  ///   entries in a node.
+  @inlinable
+  public func summary(of keys: ClosedRange<Key>) -> Summary {
+    _root.summary(
+      from: (key: keys.lowerBound, isInclusive: true),
+      to: (key: keys.upperBound, isInclusive: true))
+  }
+
+  /// Returns the summary of the key-value pairs whose keys fall within the
+  /// given range.
+  ///
+  /// - Complexity: O(`log n`) node visits and O(*B* `log n`) calls to
+  ///   `SortedDictionarySummary.add(_:)`, where `n` is the number of
+  ///   key-value pairs in the dictionary and *B* is the maximum number of
+  ///   entries in a node.
+  @inlinable
+  public func summary(of keys: PartialRangeFrom<Key>) -> Summary {
+    _root.summary(
+      from: (key: keys.lowerBound, isInclusive: true),
+      to: nil)
+  }
+
+  /// Returns the summary of the key-value pairs whose keys fall within the
+  /// given range.
+  ///
+  /// - Complexity: O(`log n`) node visits and O(*B* `log n`) calls to
+  ///   `SortedDictionarySummary.add(_:)`, where `n` is the number of
+  ///   key-value pairs in the dictionary and *B* is the maximum number of
+  ///   entries in a node.
+  @inlinable
+  public func summary(of keys: PartialRangeUpTo<Key>) -> Summary {
+    _root.summary(
+      from: nil,
+      to: (key: keys.upperBound, isInclusive: false))
+  }
+
+  /// Returns the summary of the key-value pairs whose keys fall within the
+  /// given range.
+  ///
+  /// - Complexity: O(`log n`) node visits and O(*B* `log n`) calls to
+  ///   `SortedDictionarySummary.add(_:)`, where `n` is the number of
+  ///   key-value pairs in the dictionary and *B* is the maximum number of
+  ///   entries in a node.
+  @inlinable
+  public func summary(of keys: PartialRangeThrough<Key>) -> Summary {
+    _root.summary(
+      from: nil,
+      to: (key: keys.upperBound, isInclusive: true))
+  }
+}
@@ -0,0 +1,167 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A sorted dictionary that can efficiently summarize any range of its keys.
+///
+/// A summarized sorted dictionary keeps its key-value pairs in ascending
+/// order of their keys, like ``SortedDictionary``. In addition, every node of
+/// its underlying tree caches the summary of the key-value pairs beneath it,
+/// as defined by a ``SortedDictionarySummary``. This lets the dictionary
+/// answer aggregate queries over a range of keys, such as sums, minimums or
+/// maximums, by combining O(*B* log *n*) summaries rather than by visiting
+/// every key-value pair in the range, where *B* is the maximum number of
+/// entries in a node:
+///
+///     var prices: SummarizedSortedDictionary<Total> = [:]
+///     prices[day1] = 10
+///     prices[day2] = 25
+///     prices[day3] = 5
+///     prices.summary(of: day1 ... day2).sum // 35
+///
+/// The cached summaries are kept up to date on every insertion, update and
+/// removal. As summaries can't be subtracted, every node along the path to
+/// the modified key recomputes its summary from scratch: leaves call
+/// `SortedDictionarySummary.init(key:value:)` for each of their key-value
+/// pairs, and internal nodes combine the summaries of their children. This
+/// costs O(*B* log *n*) additional calls to `init(key:value:)` and
+/// `add(_:)` per modification.
+public struct SummarizedSortedDictionary<Summary: SortedDictionarySummary> {
+  /// The type of the keys in the dictionary.
+  public typealias Key = Summary.Key
+
+  /// The type of the values in the dictionary.
+  public typealias Value = Summary.Value
+
+  /// An element of the dictionary. A key-value tuple.
+  public typealias Element = (key: Key, value: Value)
+
+  @usableFromInline
+  internal typealias _Node = _SummaryNode<Summary>
+
+  @usableFromInline
+  internal var _root: _Node
+
+  /// Creates an empty dictionary.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  public init() {
+    self._root = _Node(keys: [], values: [])
+  }
+
+  /// Creates a dictionary from a sequence of key-value pairs.
+  ///
+  /// If duplicates are encountered the last instance of the key-value pair is
+  /// the one that is kept.
+  ///
+  /// - Parameter keysAndValues: A sequence of key-value pairs to use for the
+  ///     new dictionary.
+  /// - Complexity: O(`n log n`) where `n` is the number of key-value pairs in
+  ///   `keysAndValues`.
+  @inlinable
+  public init<S: Sequence>(
+    keysWithValues keysAndValues: __owned S
+  ) where S.Element == (Key, Value) {
+    self.init()
+    for (key, value) in keysAndValues {
+      self.updateValue(value, forKey: key)
+    }
+  }
+}
+
+// MARK: Accessing Keys and Values
+extension SummarizedSortedDictionary {
+  /// The number of key-value pairs in the dictionary.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  @inline(__always)
+  public var count: Int { _root.count }
+
+  /// A Boolean value that indicates whether the dictionary is empty.
+  ///
+  /// - Complexity: O(1)
+  @inlinable
+  @inline(__always)
+  public var isEmpty: Bool { _root.count == 0 }
+
+  /// Accesses the value associated with the given key for reading and
+  /// writing.
+  ///
+  /// Assigning `nil` removes the key and its associated value from the
+  /// dictionary.
+  ///
+  /// - Parameter key: The key to find in the dictionary.
+  /// - Returns: The value associated with `key` if `key` is in the
+  ///     dictionary; otherwise, `nil`.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the dictionary.
+  @inlinable
+  public subscript(key: Key) -> Value? {
+    get {
+      _root._value(forKey: key)
+    }
+    set {
+      if let newValue = newValue {
+        updateValue(newValue, forKey: key)
+      } else {
+        removeValue(forKey: key)
+      }
+    }
+  }
+
+  /// Updates the value stored in the dictionary for the given key, or
+  /// inserts a new key-value pair if the key does not exist.
+  ///
+  /// - Parameters:
+  ///   - value: The new value to add to the dictionary.
+  ///   - key: The key to associate with `value`.
+  /// - Returns: The value that was replaced, or `nil` if a new key-value pair
+  ///     was added.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func updateValue(
+    _ value: __owned Value,
+    forKey key: Key
+  ) -> Value? {
+    defer { _checkInvariants() }
+    return _Node._updateValue(value, forKey: key, inRoot: &_root)
+  }
+
+  /// Removes the given key and its associated value from the dictionary.
+  ///
+  /// - Parameter key: The key to remove along with its associated value.
+  /// - Returns: The value that was removed, or `nil` if the key was not
+  ///     present in the dictionary.
+  /// - Complexity: O(`log n`) where `n` is the number of key-value pairs in
+  ///   the dictionary.
+  @inlinable
+  @discardableResult
+  public mutating func removeValue(forKey key: Key) -> Value? {
+    defer { _checkInvariants() }
+    return _Node._removeValue(forKey: key, inRoot: &_root)
+  }
+}
+
+extension SummarizedSortedDictionary: ExpressibleByDictionaryLiteral {
+  /// Creates a new summarized sorted dictionary from the contents of a
+  /// dictionary literal.
+  ///
+  /// - Parameter elements: A variadic list of key-value pairs for the new
+  ///    dictionary.
+  /// - Complexity: O(`n log n`)
+  @inlinable
+  public init(dictionaryLiteral elements: (Key, Value)...) {
+    self.init(keysWithValues: elements)
+  }
+}
@@ -0,0 +1,315 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// A node in the B+ tree backing a ``SummarizedSortedDictionary``.
+///
+/// Leaves store their keys in `keys`. Internal nodes route lookups with
+/// `separators`, each of which is the first key of the following child at
+/// the time it was split off. On top of the count that every
+/// ``_BPlusTreeNode`` caches, nodes also cache the summary of the key-value
+/// pairs beneath them.
+@usableFromInline
+internal final class _SummaryNode<Summary: SortedDictionarySummary> {
+  @usableFromInline
+  internal typealias Key = Summary.Key
+
+  @usableFromInline
+  internal typealias Value = Summary.Value
+
+  /// The keys of a leaf. Always empty for internal nodes.
+  @usableFromInline
+  internal var keys: ContiguousArray<Key>
+
+  /// The values of a leaf. Always empty for internal nodes.
+  @usableFromInline
+  internal var values: ContiguousArray<Value>
+
+  /// The keys separating the children of an internal node.
+  @usableFromInline
+  internal var separators: ContiguousArray<Key>
+
+  /// The children of an internal node. Always empty for leaves.
+  @usableFromInline
+  internal var children: ContiguousArray<_SummaryNode>
+
+  @usableFromInline
+  internal let isLeaf: Bool
+
+  /// The number of key-value pairs in this subtree.
+  @usableFromInline
+  internal var count: Int
+
+  /// The summary of all key-value pairs in this subtree.
+  @usableFromInline
+  internal var summary: Summary
+
+  @inlinable
+  internal init(
+    isLeaf: Bool,
+    keys: ContiguousArray<Key>,
+    values: ContiguousArray<Value>,
+    separators: ContiguousArray<Key>,
+    children: ContiguousArray<_SummaryNode>,
+    count: Int,
+    summary: Summary
+  ) {
+    self.isLeaf = isLeaf
+    self.keys = keys
+    self.values = values
+    self.separators = separators
+    self.children = children
+    self.count = count
+    self.summary = summary
+  }
+
+  /// Creates a leaf holding the given key-value pairs, which must be sorted
+  /// by key.
+  @inlinable
+  internal convenience init(
+    keys: ContiguousArray<Key>,
+    values: ContiguousArray<Value>
+  ) {
+    self.init(
+      isLeaf: true,
+      keys: keys,
+      values: values,
+      separators: [],
+      children: [],
+      count: keys.count,
+      summary: .zero)
+    _didUpdate()
+  }
+
+  /// Creates an internal node with the given children and separators.
+  @inlinable
+  internal convenience init(
+    children: ContiguousArray<_SummaryNode>,
+    separators: ContiguousArray<Key>
+  ) {
+    assert(separators.count == children.count - 1)
+    self.init(
+      isLeaf: false,
+      keys: [],
+      values: [],
+      separators: separators,
+      children: children,
+      count: children.reduce(0) { $0 + $1.count },
+      summary: .zero)
+    _didUpdate()
+  }
+
+  /// Returns a copy of this node that shares its children with it.
+  @inlinable
+  internal func copy() -> _SummaryNode {
+    _SummaryNode(
+      isLeaf: isLeaf,
+      keys: keys,
+      values: values,
+      separators: separators,
+      children: children,
+      count: count,
+      summary: summary)
+  }
+}
+
+extension _SummaryNode: _BPlusTreeNode {
+  @usableFromInline
+  internal typealias SearchKey = Key
+
+  @usableFromInline
+  internal typealias Separator = Key
+
+  /// The maximum number of key-value pairs in a leaf.
+  @inlinable
+  @inline(__always)
+  internal static var leafCapacity: Int {
+    #if DEBUG
+    return 4
+    #else
+    let capacityInBytes = 1024
+    return Swift.max(16, Swift.min(64, capacityInBytes / MemoryLayout<Key>.stride))
+    #endif
+  }
+
+  /// The maximum number of children of an internal node.
+  @inlinable
+  @inline(__always)
+  internal static var internalCapacity: Int {
+    #if DEBUG
+    return 4
+    #else
+    return 16
+    #endif
+  }
+
+  /// Returns the first slot of a leaf whose key is greater than or equal to
+  /// `key`.
+  @inlinable
+  internal func _lowerBound(of key: Key) -> Int {
+    var start = 0
+    var end = keys.count
+    while start < end {
+      let mid = start &+ (end &- start) / 2
+      if keys[mid] < key {
+        start = mid &+ 1
+      } else {
+        end = mid
+      }
+    }
+    return start
+  }
+
+  /// Returns the first slot of a leaf whose key is greater than `key`.
+  @inlinable
+  internal func _upperBound(of key: Key) -> Int {
+    var start = 0
+    var end = keys.count
+    while start < end {
+      let mid = start &+ (end &- start) / 2
+      if keys[mid] <= key {
+        start = mid &+ 1
+      } else {
+        end = mid
+      }
+    }
+    return start
+  }
+
+  @inlinable
+  internal func _leafSlot(forKey key: Key) -> (slot: Int, isFound: Bool) {
+    let slot = _lowerBound(of: key)
+    return (slot, slot < keys.count && keys[slot] == key)
+  }
+
+  @inlinable
+  internal func _childSlot(forKey key: Key) -> Int {
+    var start = 0
+    var end = separators.count
+    while start < end {
+      let mid = start &+ (end &- start) / 2
+      if separators[mid] <= key {
+        start = mid &+ 1
+      } else {
+        end = mid
+      }
+    }
+    return start
+  }
+
+  @inlinable
+  internal func _insert(
+    _ value: __owned Value,
+    forKey key: Key,
+    atSlot slot: Int
+  ) {
+    keys.insert(key, at: slot)
+    values.insert(value, at: slot)
+  }
+
+  @inlinable
+  internal func _remove(atSlot slot: Int) -> Value {
+    keys.remove(at: slot)
+    return values.remove(at: slot)
+  }
+
+  @inlinable
+  internal func _appendLeaf(_ other: _SummaryNode) {
+    keys.append(contentsOf: other.keys)
+    values.append(contentsOf: other.values)
+  }
+
+  @inlinable
+  internal func _splitLeaf(
+    at slot: Int
+  ) -> (separator: Key, node: _SummaryNode) {
+    let right = _SummaryNode(
+      keys: ContiguousArray(keys[slot...]),
+      values: ContiguousArray(values[slot...]))
+    keys.removeSubrange(slot...)
+    values.removeSubrange(slot...)
+    return (right.keys[0], right)
+  }
+
+  /// Recomputes the summary of this node from its key-value pairs or the
+  /// summaries of its children.
+  @inlinable
+  internal func _didUpdate() {
+    var summary = Summary.zero
+    if isLeaf {
+      for slot in keys.indices {
+        summary.add(Summary(key: keys[slot], value: values[slot]))
+      }
+    } else {
+      for child in children {
+        summary.add(child.summary)
+      }
+    }
+    self.summary = summary
+  }
+}
+
+// MARK: Queries
+extension _SummaryNode {
+  /// A bound of a range of keys.
+  @usableFromInline
+  internal typealias KeyBound = (key: Key, isInclusive: Bool)
+
+  /// Returns the summary of the key-value pairs in this subtree whose keys
+  /// fall within the given bounds.
+  ///
+  /// Children that lie entirely within the bounds contribute their cached
+  /// summaries, so this only descends along the paths to the two bounds.
+  @inlinable
+  internal func summary(
+    from lowerBound: KeyBound?,
+    to upperBound: KeyBound?
+  ) -> Summary {
+    if lowerBound == nil && upperBound == nil { return summary }
+
+    if isLeaf {
+      var start = 0
+      if let lowerBound = lowerBound {
+        start = lowerBound.isInclusive
+          ? _lowerBound(of: lowerBound.key)
+          : _upperBound(of: lowerBound.key)
+      }
+      var end = keys.count
+      if let upperBound = upperBound {
+        end = upperBound.isInclusive
+          ? _upperBound(of: upperBound.key)
+          : _lowerBound(of: upperBound.key)
+      }
+      var result = Summary.zero
+      var slot = start
+      while slot < end {
+        result.add(Summary(key: keys[slot], value: values[slot]))
+        slot += 1
+      }
+      return result
+    }
+
+    let first = lowerBound.map { _childSlot(forKey: $0.key) } ?? 0
+    let last = upperBound.map { _childSlot(forKey: $0.key) } ?? children.count - 1
+    if first > last { return .zero }
+    if first == last {
+      return children[first].summary(from: lowerBound, to: upperBound)
+    }
+
+    var result = children[first].summary(from: lowerBound, to: nil)
+    var slot = first + 1
+    while slot < last {
+      result.add(children[slot].summary)
+      slot += 1
+    }
+    result.add(children[last].summary(from: nil, to: upperBound))
+    return result
+  }
+}
@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+/// Returns the textual representation of the key-value pairs of a sorted
+/// dictionary, in the form `[key: value, ...]`.
+@inlinable
+internal func _sortedDictionaryDescription<Key, Value, S: Sequence>(
+  for elements: S
+) -> String where S.Element == (key: Key, value: Value) {
+  var result = "["
+  var first = true
+  for (key, value) in elements {
+    if first {
+      first = false
+    } else {
+      result += ", "
+    }
+    result += "\(key): \(value)"
+  }
+  if first { return "[:]" }
+  result += "]"
+  return result
+}
+
+/// Returns the debug representation of the key-value pairs of a sorted
+/// dictionary, wrapped in the given type name.
+@inlinable
+internal func _sortedDictionaryDebugDescription<Key, Value, S: Sequence>(
+  for elements: S,
+  typeName: String
+) -> String where S.Element == (key: Key, value: Value) {
+  var result = "\(typeName)(["
+  var first = true
+  for (key, value) in elements {
+    if first {
+      first = false
+    } else {
+      result += ", "
+    }
+
+    debugPrint(key, value, separator: ": ", terminator: "", to: &result)
+  }
+  if first { result += ":" }
+  result += "])"
+  return result
+}
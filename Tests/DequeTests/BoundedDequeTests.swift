@@ -0,0 +1,185 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import XCTest
+#if COLLECTIONS_SINGLE_MODULE
+@_spi(Testing) import Collections
+#else
+import _CollectionsTestSupport
+@_spi(Testing) import DequeModule
+#endif
+
+final class BoundedDequeTests: CollectionTestCase {
+  /// Returns a full bounded deque of the specified capacity whose contents
+  /// start at storage slot `rotation`, along with its expected contents.
+  func fullDeque(
+    capacity: Int,
+    rotation: Int,
+    tracker: LifetimeTracker
+  ) -> (BoundedDeque<LifetimeTracked<Int>>, [LifetimeTracked<Int>]) {
+    var deque = BoundedDeque<LifetimeTracked<Int>>(capacity: capacity)
+    for i in 0 ..< rotation {
+      expectTrue(deque.tryAppend(tracker.instance(for: -1 - i)))
+    }
+    deque.removeFirst(rotation)
+    let contents = tracker.instances(for: 0 ..< capacity)
+    for item in contents {
+      expectTrue(deque.tryAppend(item))
+    }
+    expectTrue(deque.isFull)
+    return (deque, contents)
+  }
+
+  func test_empty() {
+    withEvery("capacity", in: [0, 1, 2, 5, 10]) { capacity in
+      let deque = BoundedDeque<Int>(capacity: capacity)
+      expectEqual(deque.capacity, capacity)
+      expectEqual(deque.count, 0)
+      expectTrue(deque.isEmpty)
+      expectEqual(deque.isFull, capacity == 0)
+      expectEqualElements(deque, [])
+    }
+  }
+
+  func test_CollectionConformance() {
+    withEvery("capacity", in: [1, 2, 3, 5, 10]) { capacity in
+      withEvery("rotation", in: 0 ..< capacity) { rotation in
+        withLifetimeTracking { tracker in
+          let (deque, contents) = fullDeque(
+            capacity: capacity, rotation: rotation, tracker: tracker)
+          checkBidirectionalCollection(deque, expectedContents: contents)
+        }
+      }
+    }
+  }
+
+  func test_tryAppend_tryPrepend() {
+    var deque = BoundedDeque<Int>(capacity: 4)
+    expectTrue(deque.tryAppend(2))
+    expectTrue(deque.tryPrepend(1))
+    expectTrue(deque.tryAppend(3))
+    expectTrue(deque.tryPrepend(0))
+    expectTrue(deque.isFull)
+    expectFalse(deque.tryAppend(4))
+    expectFalse(deque.tryPrepend(-1))
+    expectEqualElements(deque, [0, 1, 2, 3])
+    expectEqual(deque.capacity, 4)
+  }
+
+  func test_appendOverwritingFirst() {
+    withEvery("capacity", in: [1, 2, 3, 5, 10]) { capacity in
+      withEvery("rotation", in: 0 ..< capacity) { rotation in
+        withEvery("isShared", in: [false, true]) { isShared in
+          withLifetimeTracking { tracker in
+            var (deque, contents) = fullDeque(
+              capacity: capacity, rotation: rotation, tracker: tracker)
+            let extra = tracker.instance(for: capacity)
+            withHiddenCopies(if: isShared, of: &deque) { deque in
+              let evicted = deque.appendOverwritingFirst(extra)
+              expectEqual(evicted, contents.removeFirst())
+              contents.append(extra)
+              expectEqualElements(deque, contents)
+              expectEqual(deque.capacity, capacity)
+            }
+          }
+        }
+      }
+    }
+  }
+
+  func test_prependOverwritingLast() {
+    withEvery("capacity", in: [1, 2, 3, 5, 10]) { capacity in
+      withEvery("rotation", in: 0 ..< capacity) { rotation in
+        withEvery("isShared", in: [false, true]) { isShared in
+          withLifetimeTracking { tracker in
+            var (deque, contents) = fullDeque(
+              capacity: capacity, rotation: rotation, tracker: tracker)
+            let extra = tracker.instance(for: -1)
+            withHiddenCopies(if: isShared, of: &deque) { deque in
+              let evicted = deque.prependOverwritingLast(extra)
+              expectEqual(evicted, contents.removeLast())
+              contents.insert(extra, at: 0)
+              expectEqualElements(deque, contents)
+              expectEqual(deque.capacity, capacity)
+            }
+          }
+        }
+      }
+    }
+  }
+
+  func test_overwriting_notFull() {
+    var deque = BoundedDeque<Int>(capacity: 3)
+    expectNil(deque.appendOverwritingFirst(1))
+    expectNil(deque.prependOverwritingLast(0))
+    expectEqualElements(deque, [0, 1])
+  }
+
+  func test_overwriting_zeroCapacity() {
+    var deque = BoundedDeque<Int>(capacity: 0)
+    expectEqual(deque.appendOverwritingFirst(1), 1)
+    expectEqual(deque.prependOverwritingLast(2), 2)
+    expectTrue(deque.isEmpty)
+  }
+
+  func test_slidingWindow() {
+    var window = BoundedDeque<Int>(capacity: 3)
+    for sample in 0 ..< 100 {
+      window.appendOverwritingFirst(sample)
+      expectEqualElements(window, Swift.max(0, sample - 2) ... sample)
+    }
+    expectEqual(window.capacity, 3)
+  }
+
+  func test_removal() {
+    var deque = BoundedDeque(0 ..< 6, capacity: 8)
+    expectEqual(deque.popFirst(), 0)
+    expectEqual(deque.popLast(), 5)
+    expectEqual(deque.removeFirst(), 1)
+    expectEqual(deque.removeLast(), 4)
+    expectEqualElements(deque, [2, 3])
+    deque.removeAll()
+    expectTrue(deque.isEmpty)
+    expectEqual(deque.capacity, 8)
+    expectNil(deque.popFirst())
+  }
+
+  func test_mutation_preservesCapacity() {
+    withEvery("isShared", in: [false, true]) { isShared in
+      var deque = BoundedDeque(0 ..< 5, capacity: 5)
+      withHiddenCopies(if: isShared, of: &deque) { deque in
+        deque[2] = 20
+        deque.swapAt(0, 4)
+        expectEqualElements(deque, [4, 1, 20, 3, 0])
+        expectEqual(deque.capacity, 5)
+      }
+    }
+  }
+
+  func test_Equatable_Hashable() {
+    let equivalenceClasses: [[BoundedDeque<Int>]] = [
+      [
+        BoundedDeque([1, 2, 3], capacity: 3),
+        BoundedDeque([1, 2, 3], capacity: 10),
+      ],
+      [
+        BoundedDeque([], capacity: 0),
+        BoundedDeque([], capacity: 4),
+      ],
+    ]
+    checkHashable(equivalenceClasses: equivalenceClasses)
+  }
+
+  func test_description() {
+    expectEqual("\(BoundedDeque<Int>(capacity: 2))", "[]")
+    expectEqual("\(BoundedDeque([1, 2, 3], capacity: 4))", "[1, 2, 3]")
+  }
+}
@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+#if COLLECTIONS_SINGLE_MODULE
+@_spi(Testing) import Collections
+#else
+import _CollectionsTestSupport
+@_spi(Testing) import DequeModule
+#endif
+
+/// The operations shared by the bounded concurrent queues, so that their
+/// single-threaded behavior can be checked by the same code.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+internal protocol BoundedConcurrentQueue: AnyObject {
+  associatedtype Element
+
+  var capacity: Int { get }
+  var count: Int { get }
+  var isEmpty: Bool { get }
+
+  func tryPush(_ element: __owned Element) -> Bool
+  func tryPush<C: Collection>(contentsOf elements: C) -> Int
+  where C.Element == Element
+
+  func tryPop() -> Element?
+  func tryPop<C: RangeReplaceableCollection>(
+    maximumCount: Int,
+    into target: inout C
+  ) -> Int where C.Element == Element
+}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension SPSCQueue: BoundedConcurrentQueue {}
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+extension MPMCQueue: BoundedConcurrentQueue {}
+
+/// Pushes and pops single elements in rounds of varying sizes, wrapping
+/// around the storage of queues with each of the given capacities several
+/// times.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+internal func checkTryPushTryPop<Q: BoundedConcurrentQueue>(
+  capacities: [Int],
+  _ makeQueue: (_ minimumCapacity: Int) -> Q
+) where Q.Element == LifetimeTracked<Int> {
+  withEvery("capacity", in: capacities) { capacity in
+    withLifetimeTracking { tracker in
+      let queue = makeQueue(capacity)
+      var next = 0
+      var expected = 0
+      for round in 0 ..< 4 * capacity {
+        let pushCount = round % capacity + 1
+        for _ in 0 ..< pushCount {
+          expectTrue(queue.tryPush(tracker.instance(for: next)))
+          next += 1
+        }
+        expectEqual(queue.count, pushCount)
+        if pushCount == capacity {
+          expectFalse(queue.tryPush(tracker.instance(for: -1)))
+        }
+        for _ in 0 ..< pushCount {
+          expectEqual(queue.tryPop()?.payload, expected)
+          expected += 1
+        }
+        expectNil(queue.tryPop())
+      }
+      expectEqual(tracker.instances, 0)
+    }
+  }
+}
+
+/// Pushes and pops batches of every size up to and beyond the capacity of a
+/// queue with room for 8 elements, starting at every slot of its storage.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+internal func checkBatchOperations<Q: BoundedConcurrentQueue>(
+  _ makeQueue: (_ minimumCapacity: Int) -> Q
+) where Q.Element == LifetimeTracked<Int> {
+  withEvery("rotation", in: 0 ..< 8) { rotation in
+    withEvery("batch", in: 0 ... 10) { batch in
+      withLifetimeTracking { tracker in
+        let queue = makeQueue(8)
+        for i in 0 ..< rotation {
+          expectTrue(queue.tryPush(tracker.instance(for: i)))
+          expectNotNil(queue.tryPop())
+        }
+        let items = tracker.instances(for: 0 ..< batch)
+        let pushed = queue.tryPush(contentsOf: items)
+        expectEqual(pushed, Swift.min(batch, 8))
+        expectEqual(queue.count, pushed)
+
+        var popped: [LifetimeTracked<Int>] = []
+        expectEqual(queue.tryPop(maximumCount: 3, into: &popped), Swift.min(3, pushed))
+        expectEqual(
+          queue.tryPop(maximumCount: 100, into: &popped),
+          Swift.max(0, pushed - 3))
+        expectEqualElements(popped, items.prefix(pushed))
+        expectEqual(queue.tryPop(maximumCount: 1, into: &popped), 0)
+      }
+    }
+  }
+}
+
+/// Checks that destroying a queue with room for 4 elements releases the
+/// elements still in it, wherever they are in its storage.
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+internal func checkDeinitReleasesRemainingElements<Q: BoundedConcurrentQueue>(
+  _ makeQueue: (_ minimumCapacity: Int) -> Q
+) where Q.Element == LifetimeTracked<Int> {
+  withEvery("rotation", in: 0 ..< 4) { rotation in
+    withEvery("count", in: 0 ... 4) { count in
+      withLifetimeTracking { tracker in
+        do {
+          let queue = makeQueue(4)
+          for i in 0 ..< rotation {
+            expectTrue(queue.tryPush(tracker.instance(for: i)))
+            expectNotNil(queue.tryPop())
+          }
+          for i in 0 ..< count {
+            expectTrue(queue.tryPush(tracker.instance(for: i)))
+          }
+          expectEqual(tracker.instances, count)
+        }
+        expectEqual(tracker.instances, 0)
+      }
+    }
+  }
+}
+#endif
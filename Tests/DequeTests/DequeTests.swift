@@ -373,5 +373,383 @@ final class DequeTests: CollectionTestCase {
     }
   }
 
-}
+  func test_withUnsafeSegments() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withLifetimeTracking { tracker in
+        let (deque, contents) = tracker.deque(with: layout)
+        deque.withUnsafeSegments { first, second in
+          expectEqual(second.isEmpty, !layout.isWrapped)
+          expectEqualElements(Array(first) + Array(second), contents)
+        }
+      }
+    }
+  }
+
+  func test_removeFirst_consumingSegments() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEvery("consumed", in: 0 ... layout.count) { consumed in
+        withEvery("isShared", in: [false, true]) { isShared in
+          withLifetimeTracking { tracker in
+            var (deque, contents) = tracker.deque(with: layout)
+            withHiddenCopies(if: isShared, of: &deque) { deque in
+              let actual = deque.removeFirst(consumingSegmentsWith: { first, second in
+                expectEqual(first.count + second.count, contents.count)
+                return consumed
+              })
+              expectEqual(actual, consumed)
+              contents.removeFirst(consumed)
+              expectEqualElements(deque, contents)
+            }
+          }
+        }
+      }
+    }
+  }
+
+  func test_removeFirst_consumingSegments_throw() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withLifetimeTracking { tracker in
+        var (deque, contents) = tracker.deque(with: layout)
+        expectThrows(
+          try deque.removeFirst(consumingSegmentsWith: { _, _ in
+            throw TestError(layout.count)
+          })
+        ) { error in
+          expectEqual(error as? TestError, TestError(layout.count))
+        }
+        expectEqualElements(deque, contents)
+        contents.removeAll()
+      }
+    }
+  }
 
+  func test_append_unsafeUninitializedCapacity() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEvery("reserved", in: [0, 1, 3, 10]) { reserved in
+        withEvery("initialized", in: Set([0, reserved / 2, reserved])) { initialized in
+          withEvery("isShared", in: [false, true]) { isShared in
+            withLifetimeTracking { tracker in
+              var (deque, contents) = tracker.deque(with: layout)
+              let extra = tracker.instances(
+                for: layout.count ..< layout.count + initialized)
+              withHiddenCopies(if: isShared, of: &deque) { deque in
+                let result: Int = deque.append(
+                  unsafeUninitializedCapacity: reserved,
+                  initializingWith: { first, second, initializedCount in
+                    expectEqual(first.count + second.count, reserved)
+                    expectEqual(initializedCount, 0)
+                    for i in 0 ..< initialized {
+                      if i < first.count {
+                        (first.baseAddress! + i).initialize(to: extra[i])
+                      } else {
+                        let j = i - first.count
+                        (second.baseAddress! + j).initialize(to: extra[i])
+                      }
+                    }
+                    initializedCount = initialized
+                    return 42
+                  })
+                expectEqual(result, 42)
+                contents.append(contentsOf: extra)
+                expectEqualElements(deque, contents)
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  func test_append_unsafeUninitializedCapacity_throw() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withLifetimeTracking { tracker in
+        var (deque, contents) = tracker.deque(with: layout)
+        let extra = tracker.instance(for: layout.count)
+        expectThrows(
+          try deque.append(
+            unsafeUninitializedCapacity: 2,
+            initializingWith: { first, second, initializedCount -> Int in
+              first.baseAddress!.initialize(to: extra)
+              initializedCount = 1
+              throw TestError(1)
+            })
+        ) { error in
+          expectEqual(error as? TestError, TestError(1))
+        }
+        contents.append(extra)
+        expectEqualElements(deque, contents)
+      }
+    }
+  }
+
+  func test_appendManyFromDeque() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEveryDeque("source", ofCapacities: [0, 1, 3, 5], startValue: 100) { sourceLayout in
+        withEvery("isShared", in: [false, true]) { isShared in
+          withLifetimeTracking { tracker in
+            var (deque, contents) = tracker.deque(with: layout)
+            let (source, extra) = tracker.deque(with: sourceLayout)
+            withHiddenCopies(if: isShared, of: &deque) { deque in
+              contents.append(contentsOf: extra)
+              deque.append(contentsOf: source)
+              expectEqualElements(deque, contents)
+            }
+          }
+        }
+      }
+    }
+  }
+
+  func test_prependManyFromDeque() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEveryDeque("source", ofCapacities: [0, 1, 3, 5], startValue: 100) { sourceLayout in
+        withEvery("isShared", in: [false, true]) { isShared in
+          withLifetimeTracking { tracker in
+            var (deque, contents) = tracker.deque(with: layout)
+            let (source, extra) = tracker.deque(with: sourceLayout)
+            withHiddenCopies(if: isShared, of: &deque) { deque in
+              contents.insert(contentsOf: extra, at: 0)
+              deque.prepend(contentsOf: source)
+              expectEqualElements(deque, contents)
+            }
+          }
+        }
+      }
+    }
+  }
+
+  func test_appendManyFromSelf() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withLifetimeTracking { tracker in
+        var (deque, contents) = tracker.deque(with: layout)
+        deque.append(contentsOf: deque)
+        deque.prepend(contentsOf: deque)
+        contents = contents + contents + contents + contents
+        expectEqualElements(deque, contents)
+      }
+    }
+  }
+
+  func test_append_prepend_copyingBytes() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEvery("extraCount", in: 0 ..< 6) { extraCount in
+        withEvery("isShared", in: [false, true]) { isShared in
+          let contents = (0 ..< layout.count).map { UInt32($0) }
+          let extra = (0 ..< extraCount).map { UInt32(100 + $0) }
+          // Prefix the raw bytes with a single padding byte, so that the
+          // source isn't properly aligned for `UInt32`.
+          let bytes: [UInt8] = [0] + extra.withUnsafeBytes { Array($0) }
+          var deque = Deque(layout: layout, contents: contents)
+          withHiddenCopies(if: isShared, of: &deque) { deque in
+            bytes.withUnsafeBytes { buffer in
+              let source = UnsafeRawBufferPointer(rebasing: buffer.dropFirst())
+              deque.append(copyingBytesFrom: source)
+              expectEqualElements(deque, contents + extra)
+              deque.prepend(copyingBytesFrom: source)
+              expectEqualElements(deque, extra + contents + extra)
+            }
+          }
+        }
+      }
+    }
+  }
+
+  func test_removeFirst_into() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEvery("n", in: 0 ... layout.count) { n in
+        withEvery("isShared", in: [false, true]) { isShared in
+          withLifetimeTracking { tracker in
+            var (deque, contents) = tracker.deque(with: layout)
+            let target = UnsafeMutableBufferPointer<LifetimeTracked<Int>>
+              .allocate(capacity: n + 1)
+            defer { target.deallocate() }
+            withHiddenCopies(if: isShared, of: &deque) { deque in
+              deque.removeFirst(n, into: target)
+              expectEqualElements(target.prefix(n), contents.prefix(n))
+              expectEqualElements(deque, contents.dropFirst(n))
+            }
+            UnsafeMutableBufferPointer(rebasing: target.prefix(n)).deinitialize()
+          }
+        }
+      }
+    }
+  }
+
+  func test_shrinkToFit() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEvery("isShared", in: [false, true]) { isShared in
+        withLifetimeTracking { tracker in
+          var (deque, contents) = tracker.deque(with: layout)
+          withHiddenCopies(if: isShared, of: &deque) { deque in
+            deque.shrinkToFit()
+            expectEqualElements(deque, contents)
+            expectEqual(deque._capacity, contents.count)
+          }
+        }
+      }
+    }
+  }
+
+  func test_shrinkToFit_largeBuffer() {
+    var deque = Deque<Int>(minimumCapacity: 1000)
+    deque.append(contentsOf: 0 ..< 500)
+    deque.removeFirst(490)
+    deque.append(contentsOf: 500 ..< 510)
+    deque.shrinkToFit()
+    expectEqualElements(deque, 490 ..< 510)
+    expectEqual(deque._capacity, 20)
+    expectEqual(deque._startSlot, 0)
+
+    deque.removeAll(keepingCapacity: true)
+    deque.shrinkToFit()
+    expectEqual(deque._capacity, 0)
+  }
+
+  func test_storagePolicy_default() {
+    var deque = Deque<Int>(minimumCapacity: 100)
+    expectEqual(deque.storagePolicy, .default)
+    expectEqual(deque.storagePolicy.growthFactor, 1.5)
+    expectEqual(deque.storagePolicy.shrinkThreshold, 0)
+    let capacity = deque._capacity
+    deque.append(contentsOf: 0 ..< 100)
+    deque.removeFirst(99)
+    expectEqual(deque._capacity, capacity)
+  }
+
+  func test_storagePolicy_isSharedByCopies() {
+    let policy = DequeStoragePolicy(
+      growthFactor: 2, shrinkThreshold: 0.25, minimumCapacity: 8)
+    var deque: Deque<Int> = []
+    deque.storagePolicy = policy
+    expectEqual(deque.storagePolicy, policy)
+
+    var copy = deque
+    expectEqual(copy.storagePolicy, policy)
+    copy.append(contentsOf: 0 ..< 100)
+    expectEqual(copy.storagePolicy, policy)
+    copy.storagePolicy = .default
+    expectEqual(copy.storagePolicy, .default)
+    expectEqual(deque.storagePolicy, policy)
+
+    // Reallocations and copy-on-write copies preserve the policy.
+    deque.append(contentsOf: 0 ..< 100)
+    copy = deque
+    deque.prepend(contentsOf: 0 ..< 100)
+    expectEqual(deque.storagePolicy, policy)
+    expectEqual(copy.storagePolicy, policy)
+    copy.removeFirst(10)
+    expectEqual(copy.storagePolicy, policy)
+
+    deque.removeAll()
+    expectEqual(deque.storagePolicy, policy)
+    deque.removeAll(keepingCapacity: true)
+    expectEqual(deque.storagePolicy, policy)
+    deque = []
+    expectEqual(deque.storagePolicy, .default)
+  }
+
+  func test_storagePolicy_growthFactor() {
+    withEvery("growthFactor", in: [1.25, 2, 4] as [Double]) { growthFactor in
+      var deque: Deque<Int> = []
+      deque.storagePolicy = DequeStoragePolicy(growthFactor: growthFactor)
+      var capacity = deque._capacity
+      for i in 0 ..< 1000 {
+        deque.append(i)
+        let newCapacity = deque._capacity
+        if newCapacity != capacity {
+          let expected = Int((growthFactor * Double(capacity)).rounded(.up))
+          expectGreaterThanOrEqual(newCapacity, expected)
+          capacity = newCapacity
+        }
+      }
+      expectEqualElements(deque, 0 ..< 1000)
+    }
+  }
+
+  func test_storagePolicy_shrinksOnRemoval() {
+    let methods = [
+      "popFirst", "popLast", "removeFirst", "removeLast", "removeFirst(n)",
+      "removeLast(n)", "remove(at:)", "removeSubrange", "replaceSubrange",
+      "removeFirst(into:)", "removeFirst(consumingSegmentsWith:)",
+    ]
+    withEvery("method", in: methods) { method in
+      withLifetimeTracking { tracker in
+        let policy = DequeStoragePolicy(shrinkThreshold: 0.25, minimumCapacity: 16)
+        var deque: Deque<LifetimeTracked<Int>> = []
+        deque.storagePolicy = policy
+        var contents = tracker.instances(for: 0 ..< 1000)
+        deque.append(contentsOf: contents)
+        // Prepend a few elements so that the contents wrap around.
+        deque.removeFirst(3)
+        deque.prepend(contentsOf: contents[..<3])
+        let peak = deque._capacity
+        let target = UnsafeMutableBufferPointer<LifetimeTracked<Int>>
+          .allocate(capacity: 3)
+        defer { target.deallocate() }
+
+        while contents.count > 4 {
+          switch method {
+          case "popFirst":
+            expectEqual(deque.popFirst(), contents.removeFirst())
+          case "popLast":
+            expectEqual(deque.popLast(), contents.removeLast())
+          case "removeFirst":
+            expectEqual(deque.removeFirst(), contents.removeFirst())
+          case "removeLast":
+            expectEqual(deque.removeLast(), contents.removeLast())
+          case "removeFirst(n)":
+            deque.removeFirst(3)
+            contents.removeFirst(3)
+          case "removeLast(n)":
+            deque.removeLast(3)
+            contents.removeLast(3)
+          case "remove(at:)":
+            let i = contents.count / 2
+            expectEqual(deque.remove(at: i), contents.remove(at: i))
+          case "removeSubrange":
+            let i = contents.count / 3
+            deque.removeSubrange(i ..< i + 3)
+            contents.removeSubrange(i ..< i + 3)
+          case "replaceSubrange":
+            let i = contents.count / 3
+            deque.replaceSubrange(i ..< i + 3, with: contents[i ..< i + 1])
+            contents.replaceSubrange(i ..< i + 3, with: contents[i ..< i + 1])
+          case "removeFirst(into:)":
+            deque.removeFirst(3, into: target)
+            expectEqualElements(target, contents.prefix(3))
+            UnsafeMutableBufferPointer(rebasing: target[...]).deinitialize()
+            contents.removeFirst(3)
+          case "removeFirst(consumingSegmentsWith:)":
+            let removed = deque.removeFirst(consumingSegmentsWith: { _, _ in 3 })
+            expectEqual(removed, 3)
+            contents.removeFirst(3)
+          default:
+            fatalError("Unexpected method \(method)")
+          }
+          let capacity = deque._capacity
+          expectGreaterThanOrEqual(capacity, policy.minimumCapacity)
+          if capacity > policy.minimumCapacity {
+            expectGreaterThanOrEqual(
+              Double(deque.count), policy.shrinkThreshold * Double(capacity))
+          }
+        }
+        expectEqualElements(deque, contents)
+        expectLessThan(deque._capacity, peak / 10)
+        expectEqual(deque.storagePolicy, policy)
+        deque = []
+        contents = []
+        expectEqual(tracker.instances, 0)
+      }
+    }
+  }
+
+  func test_storagePolicy_shrinksWhenSet() {
+    var deque = Deque(0 ..< 1000)
+    deque.removeFirst(990)
+    let capacity = deque._capacity
+    expectGreaterThanOrEqual(capacity, 1000)
+    deque.storagePolicy = DequeStoragePolicy(shrinkThreshold: 0.1)
+    expectLessThan(deque._capacity, 64)
+    expectEqualElements(deque, 990 ..< 1000)
+  }
+}
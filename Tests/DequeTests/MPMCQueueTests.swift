@@ -0,0 +1,139 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import XCTest
+import Foundation
+import Synchronization
+#if COLLECTIONS_SINGLE_MODULE
+@_spi(Testing) import Collections
+#else
+import _CollectionsTestSupport
+@_spi(Testing) import DequeModule
+#endif
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+private final class _ConsumerState: Sendable {
+  let remaining: Atomic<Int>
+  let results = Mutex<[[Int]]>([])
+
+  init(expectedCount: Int) {
+    remaining = Atomic(expectedCount)
+  }
+}
+
+final class MPMCQueueTests: CollectionTestCase {
+  func test_capacity() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    let cases: [(minimum: Int, actual: Int)] = [
+      (0, 2), (1, 2), (2, 2), (3, 4), (5, 8), (16, 16), (100, 128),
+    ]
+    withEvery("case", in: cases) { c in
+      let queue = MPMCQueue<Int>(minimumCapacity: c.minimum)
+      expectEqual(queue.capacity, c.actual)
+      expectEqual(queue.count, 0)
+      expectTrue(queue.isEmpty)
+    }
+  }
+
+  func test_tryPush_tryPop() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    checkTryPushTryPop(capacities: [2, 4, 8]) {
+      MPMCQueue<LifetimeTracked<Int>>(minimumCapacity: $0)
+    }
+  }
+
+  func test_batchOperations() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    checkBatchOperations {
+      MPMCQueue<LifetimeTracked<Int>>(minimumCapacity: $0)
+    }
+  }
+
+  func test_deinit_releasesRemainingElements() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    checkDeinitReleasesRemainingElements {
+      MPMCQueue<LifetimeTracked<Int>>(minimumCapacity: $0)
+    }
+  }
+
+  func test_multipleProducersAndConsumers() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    let producerCount = 4
+    let consumerCount = 4
+    let itemsPerProducer = 20_000
+    let total = producerCount * itemsPerProducer
+    withEvery("capacity", in: [2, 64]) { capacity in
+      withEvery("batched", in: [false, true]) { batched in
+        let queue = MPMCQueue<Int>(minimumCapacity: capacity)
+        let state = _ConsumerState(expectedCount: total)
+        let done = DispatchSemaphore(value: 0)
+
+        for p in 0 ..< producerCount {
+          let items = p * itemsPerProducer ..< (p + 1) * itemsPerProducer
+          Thread {
+            if batched {
+              var i = items.lowerBound
+              while i < items.upperBound {
+                i += queue.tryPush(contentsOf: i ..< Swift.min(i + 7, items.upperBound))
+              }
+            } else {
+              for i in items {
+                queue.push(i)
+              }
+            }
+            done.signal()
+          }.start()
+        }
+        for _ in 0 ..< consumerCount {
+          Thread {
+            var received: [Int] = []
+            while state.remaining.load(ordering: .relaxed) > 0 {
+              let n = queue.tryPop(maximumCount: batched ? 5 : 1, into: &received)
+              if n > 0 {
+                state.remaining.subtract(n, ordering: .relaxed)
+              }
+            }
+            state.results.withLock { $0.append(received) }
+            done.signal()
+          }.start()
+        }
+        for _ in 0 ..< producerCount + consumerCount {
+          done.wait()
+        }
+
+        let received = state.results.withLock { $0 }
+        // Each consumer must see every producer's elements in order.
+        for chunk in received {
+          var last = Array(repeating: -1, count: producerCount)
+          for value in chunk {
+            let p = value / itemsPerProducer
+            expectLessThan(last[p], value)
+            last[p] = value
+          }
+        }
+        expectEqualElements(received.joined().sorted(), 0 ..< total)
+        expectTrue(queue.isEmpty)
+      }
+    }
+  }
+}
+#endif
@@ -164,4 +164,81 @@ final class MutableCollectiontests: CollectionTestCase {
       }
     }
   }
+
+  func test_partition() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEvery("pivot", in: 0 ... layout.count) { pivot in
+        withEvery("isShared", in: [false, true]) { isShared in
+          withLifetimeTracking { tracker in
+            var (deque, contents) = tracker.deque(with: layout)
+            withHiddenCopies(if: isShared, of: &deque) { deque in
+              let index = deque.partition(by: { $0.payload >= pivot })
+              expectEqual(index, pivot)
+              expectEqualElements(
+                deque[..<index].map { $0.payload }.sorted(), 0 ..< pivot)
+              expectEqualElements(
+                deque[index...].map { $0.payload }.sorted(), pivot ..< layout.count)
+              expectEqualElements(
+                deque.map { $0.payload }.sorted(),
+                contents.map { $0.payload })
+            }
+          }
+        }
+      }
+    }
+  }
+
+  func test_sort() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      withEvery("isShared", in: [false, true]) { isShared in
+        withLifetimeTracking { tracker in
+          var (deque, contents) = tracker.deque(with: layout)
+          deque.sort(by: { $0.payload > $1.payload })
+          contents.reverse()
+          expectEqualElements(deque, contents)
+          withHiddenCopies(if: isShared, of: &deque) { deque in
+            deque.sort(by: { $0.payload < $1.payload })
+            expectEqualElements(deque, contents.reversed())
+          }
+        }
+      }
+    }
+  }
+
+  func test_sort_Comparable() {
+    withEveryDeque("deque", ofCapacities: [0, 1, 2, 3, 5, 10]) { layout in
+      var deque = Deque(layout: layout, contents: (0 ..< layout.count).reversed())
+      deque.sort()
+      expectEqualElements(deque, 0 ..< layout.count)
+    }
+  }
+
+  func test_partitionAroundNthElement() {
+    withEveryDeque("deque", ofCapacities: [1, 2, 3, 5, 10, 20, 33]) { layout in
+      withEvery("n", in: 0 ..< layout.count) { n in
+        withEvery("isShared", in: [false, true]) { isShared in
+          withLifetimeTracking { tracker in
+            // Use a scrambled sequence of values with duplicates.
+            let values = (0 ..< layout.count).map { ($0 * 7 + 3) % layout.count / 2 }
+            let sorted = values.sorted()
+            var deque = Deque(
+              layout: layout, contents: values.map { tracker.instance(for: $0) })
+            withHiddenCopies(if: isShared, of: &deque) { deque in
+              let selected = deque.partition(aroundNthElement: n) {
+                $0.payload < $1.payload
+              }
+              expectEqual(selected.payload, sorted[n])
+              expectEqual(deque[n].payload, sorted[n])
+              for i in 0 ..< n {
+                expectLessThanOrEqual(deque[i].payload, sorted[n])
+              }
+              for i in n + 1 ..< layout.count {
+                expectGreaterThanOrEqual(deque[i].payload, sorted[n])
+              }
+            }
+          }
+        }
+      }
+    }
+  }
 }
@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import XCTest
+import Foundation
+#if COLLECTIONS_SINGLE_MODULE
+@_spi(Testing) import Collections
+#else
+import _CollectionsTestSupport
+@_spi(Testing) import DequeModule
+#endif
+
+final class SPSCQueueTests: CollectionTestCase {
+  func test_capacity() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    let cases: [(minimum: Int, actual: Int)] = [
+      (0, 1), (1, 1), (2, 2), (3, 4), (5, 8), (16, 16), (100, 128),
+    ]
+    withEvery("case", in: cases) { c in
+      let queue = SPSCQueue<Int>(minimumCapacity: c.minimum)
+      expectEqual(queue.capacity, c.actual)
+      expectEqual(queue.count, 0)
+      expectTrue(queue.isEmpty)
+    }
+  }
+
+  func test_tryPush_tryPop() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    checkTryPushTryPop(capacities: [1, 2, 4, 8]) {
+      SPSCQueue<LifetimeTracked<Int>>(minimumCapacity: $0)
+    }
+  }
+
+  func test_batchOperations() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    checkBatchOperations {
+      SPSCQueue<LifetimeTracked<Int>>(minimumCapacity: $0)
+    }
+  }
+
+  func test_deinit_releasesRemainingElements() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    checkDeinitReleasesRemainingElements {
+      SPSCQueue<LifetimeTracked<Int>>(minimumCapacity: $0)
+    }
+  }
+
+  func test_producerConsumer() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    let count = 100_000
+    withEvery("capacity", in: [1, 16, 1024]) { capacity in
+      withEvery("batched", in: [false, true]) { batched in
+        let queue = SPSCQueue<Int>(minimumCapacity: capacity)
+        let producerDone = DispatchSemaphore(value: 0)
+        let producer = Thread {
+          if batched {
+            var i = 0
+            while i < count {
+              i += queue.tryPush(contentsOf: i ..< Swift.min(i + 37, count))
+            }
+          } else {
+            for i in 0 ..< count {
+              queue.push(i)
+            }
+          }
+          producerDone.signal()
+        }
+        producer.start()
+
+        var received: [Int] = []
+        received.reserveCapacity(count)
+        while received.count < count {
+          if batched {
+            _ = queue.tryPop(maximumCount: 29, into: &received)
+          } else {
+            received.append(queue.pop())
+          }
+        }
+        producerDone.wait()
+        expectEqualElements(received, 0 ..< count)
+        expectTrue(queue.isEmpty)
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,165 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import XCTest
+import Foundation
+import Synchronization
+#if COLLECTIONS_SINGLE_MODULE
+@_spi(Testing) import Collections
+#else
+import _CollectionsTestSupport
+@_spi(Testing) import DequeModule
+#endif
+
+@available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *)
+private final class _StealResults: Sendable {
+  let ownerDone = Atomic<Bool>(false)
+  let stolen = Mutex<[[Int]]>([])
+}
+
+final class WorkStealingDequeTests: CollectionTestCase {
+  func test_empty() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    let deque = WorkStealingDeque<Int>(minimumCapacity: 5)
+    expectEqual(deque.capacity, 8)
+    expectTrue(deque.isEmpty)
+    expectNil(deque.pop())
+    expectNil(deque.steal())
+    expectNil(deque.trySteal())
+    expectEqual(deque.count, 0)
+  }
+
+  func test_ownerIsLIFO_thievesAreFIFO() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    withLifetimeTracking { tracker in
+      let deque = WorkStealingDeque<LifetimeTracked<Int>>(minimumCapacity: 4)
+      for i in 0 ..< 6 {
+        deque.push(tracker.instance(for: i))
+      }
+      expectEqual(deque.count, 6)
+      expectEqual(deque.steal()?.payload, 0)
+      expectEqual(deque.pop()?.payload, 5)
+      expectEqual(deque.trySteal()?.payload, 1)
+      expectEqual(deque.pop()?.payload, 4)
+      expectEqual(deque.pop()?.payload, 3)
+      expectEqual(deque.steal()?.payload, 2)
+      expectNil(deque.pop())
+      expectNil(deque.steal())
+      expectEqual(tracker.instances, 0)
+    }
+  }
+
+  func test_growth() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    withEvery("stolen", in: [0, 1, 3]) { stolen in
+      withLifetimeTracking { tracker in
+        let deque = WorkStealingDeque<LifetimeTracked<Int>>(minimumCapacity: 1)
+        var expected: [Int] = []
+        // Interleave steals with pushes so that the live range wraps around
+        // the buffer when it grows.
+        for i in 0 ..< 100 {
+          deque.push(tracker.instance(for: i))
+          expected.append(i)
+          if i % 4 == 0 && expected.count > stolen {
+            for _ in 0 ..< stolen {
+              expectEqual(deque.steal()?.payload, expected.removeFirst())
+            }
+          }
+        }
+        expectGreaterThanOrEqual(deque.capacity, expected.count)
+        expectEqual(deque.count, expected.count)
+        while let value = deque.pop() {
+          expectEqual(value.payload, expected.removeLast())
+        }
+        expectEqual(expected, [])
+      }
+    }
+  }
+
+  func test_deinit_releasesRemainingElements() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    withEvery("count", in: [0, 1, 5, 40]) { count in
+      withLifetimeTracking { tracker in
+        do {
+          let deque = WorkStealingDeque<LifetimeTracked<Int>>(minimumCapacity: 4)
+          deque.push(tracker.instance(for: -1))
+          _ = deque.steal()
+          for i in 0 ..< count {
+            deque.push(tracker.instance(for: i))
+          }
+          expectEqual(tracker.instances, count)
+        }
+        expectEqual(tracker.instances, 0)
+      }
+    }
+  }
+
+  func test_concurrentStealing() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    let total = 100_000
+    let thiefCount = 4
+    let deque = WorkStealingDeque<Int>(minimumCapacity: 2)
+    let results = _StealResults()
+    let done = DispatchSemaphore(value: 0)
+
+    for _ in 0 ..< thiefCount {
+      Thread {
+        var stolen: [Int] = []
+        while true {
+          if let value = deque.steal() {
+            stolen.append(value)
+          } else if results.ownerDone.load(ordering: .acquiring) {
+            break
+          }
+        }
+        results.stolen.withLock { $0.append(stolen) }
+        done.signal()
+      }.start()
+    }
+
+    // The owner pushes everything, occasionally popping some elements back,
+    // forcing the buffer to grow while the thieves are at work.
+    var popped: [Int] = []
+    for i in 0 ..< total {
+      deque.push(i)
+      if i % 3 == 0, let value = deque.pop() {
+        popped.append(value)
+      }
+    }
+    while let value = deque.pop() {
+      popped.append(value)
+    }
+    results.ownerDone.store(true, ordering: .releasing)
+    for _ in 0 ..< thiefCount {
+      done.wait()
+    }
+
+    let stolen = results.stolen.withLock { $0 }
+    for chunk in stolen {
+      // Each thief sees elements in the order they were pushed.
+      expectEqualElements(chunk, chunk.sorted())
+    }
+    expectEqualElements((popped + stolen.joined()).sorted(), 0 ..< total)
+    expectTrue(deque.isEmpty)
+  }
+}
+#endif
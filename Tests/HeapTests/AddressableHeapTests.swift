@@ -0,0 +1,229 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import XCTest
+#if COLLECTIONS_SINGLE_MODULE
+import Collections
+#else
+import _CollectionsTestSupport
+import HeapModule
+#endif
+
+final class AddressableHeapTests: CollectionTestCase {
+  func test_empty() {
+    var heap = AddressableHeap<Int>()
+    expectTrue(heap.isEmpty)
+    expectEqual(heap.count, 0)
+    expectNil(heap.min)
+    expectNil(heap.max)
+    expectNil(heap.minHandle)
+    expectNil(heap.maxHandle)
+    expectNil(heap.popMin())
+    expectNil(heap.popMax())
+    expectEqual(heap.description, "<0 items>")
+  }
+
+  func test_insert_pop() {
+    withEvery("c", in: 0 ..< 50) { c in
+      var rng = RepeatableRandomNumberGenerator(seed: c)
+      var heap = AddressableHeap<Int>()
+      for value in (0 ..< c).shuffled(using: &rng) {
+        heap.insert(value)
+      }
+      expectEqual(heap.count, c)
+      expectEqualElements(heap.unordered.sorted(), 0 ..< c)
+      var lower = 0
+      var upper = c - 1
+      var takeMin = true
+      while !heap.isEmpty {
+        if takeMin {
+          expectEqual(heap.popMin(), lower)
+          lower += 1
+        } else {
+          expectEqual(heap.popMax(), upper)
+          upper -= 1
+        }
+        takeMin.toggle()
+      }
+      expectEqual(lower, upper + 1)
+    }
+  }
+
+  func test_handles() {
+    var heap = AddressableHeap<String>()
+    let b = heap.insert("b")
+    let a = heap.insert("a")
+    let c = heap.insert("c")
+    expectEqual(heap[a], "a")
+    expectEqual(heap[b], "b")
+    expectEqual(heap[c], "c")
+    expectEqual(heap.minHandle, a)
+    expectEqual(heap.maxHandle, c)
+
+    expectEqual(heap.update(c, to: "0"), "c")
+    expectEqual(heap.minHandle, c)
+    expectEqual(heap.maxHandle, b)
+    expectEqual(heap[c], "0")
+
+    expectEqual(heap.remove(b), "b")
+    expectFalse(heap.contains(b))
+    expectTrue(heap.contains(a))
+    expectTrue(heap.contains(c))
+    expectEqual(heap.count, 2)
+
+    // Slots are recycled, but old handles stay invalid.
+    let d = heap.insert("d")
+    expectNotEqual(d, b)
+    expectFalse(heap.contains(b))
+    expectEqual(heap[d], "d")
+    expectEqual(heap.max, "d")
+  }
+
+  func test_copiesShareHandles() {
+    var heap = AddressableHeap<Int>()
+    let handles = (0 ..< 10).map { heap.insert($0) }
+    var copy = heap
+    copy.update(handles[3], to: -1)
+    copy.remove(handles[5])
+    expectEqual(heap[handles[3]], 3)
+    expectTrue(heap.contains(handles[5]))
+    expectEqual(copy[handles[3]], -1)
+    expectFalse(copy.contains(handles[5]))
+    expectEqual(copy.min, -1)
+    expectEqual(heap.min, 0)
+  }
+
+  func test_removeAll() {
+    withEvery("keepCapacity", in: [false, true]) { keepCapacity in
+      var heap = AddressableHeap<Int>()
+      let handles = (0 ..< 20).map { heap.insert($0) }
+      heap.removeAll(keepingCapacity: keepCapacity)
+      expectTrue(heap.isEmpty)
+      for handle in handles {
+        expectFalse(heap.contains(handle))
+      }
+      let new = heap.insert(42)
+      expectTrue(heap.contains(new))
+      expectFalse(handles.contains(new))
+      expectEqual(heap.min, 42)
+    }
+  }
+
+  func test_randomOperations() {
+    withEvery("seed", in: 0 ..< 20) { seed in
+      var rng = RepeatableRandomNumberGenerator(seed: seed)
+      var heap = AddressableHeap<Int>()
+      var reference: [AddressableHeap<Int>.Handle: Int] = [:]
+      var removed: [AddressableHeap<Int>.Handle] = []
+
+      for _ in 0 ..< 1000 {
+        switch Int.random(in: 0 ..< 10, using: &rng) {
+        case 0 ..< 4:
+          let value = Int.random(in: 0 ..< 100, using: &rng)
+          let handle = heap.insert(value)
+          expectNil(reference[handle])
+          reference[handle] = value
+        case 4 ..< 6:
+          guard let handle = reference.keys.randomElement(using: &rng) else {
+            continue
+          }
+          let value = Int.random(in: 0 ..< 100, using: &rng)
+          expectEqual(heap.update(handle, to: value), reference[handle])
+          reference[handle] = value
+        case 6:
+          guard let handle = reference.keys.randomElement(using: &rng) else {
+            continue
+          }
+          expectEqual(heap.remove(handle), reference.removeValue(forKey: handle))
+          removed.append(handle)
+        case 7:
+          let handle = heap.minHandle
+          let min = heap.popMin()
+          expectEqual(min, reference.values.min())
+          if let handle = handle {
+            expectEqual(reference.removeValue(forKey: handle), min)
+            removed.append(handle)
+          }
+        default:
+          let handle = heap.maxHandle
+          let max = heap.popMax()
+          expectEqual(max, reference.values.max())
+          if let handle = handle {
+            expectEqual(reference.removeValue(forKey: handle), max)
+            removed.append(handle)
+          }
+        }
+        expectEqual(heap.count, reference.count)
+        expectEqual(heap.min, reference.values.min())
+        expectEqual(heap.max, reference.values.max())
+      }
+      for (handle, value) in reference {
+        expectTrue(heap.contains(handle))
+        expectEqual(heap[handle], value)
+      }
+      for handle in removed {
+        expectFalse(heap.contains(handle))
+      }
+    }
+  }
+
+  func test_dijkstra() {
+    struct Tentative: Comparable {
+      var distance: Int
+      var vertex: Int
+      static func < (left: Self, right: Self) -> Bool {
+        (left.distance, left.vertex) < (right.distance, right.vertex)
+      }
+    }
+
+    // A random directed graph, stored as adjacency lists.
+    let vertexCount = 200
+    var rng = RepeatableRandomNumberGenerator(seed: 0)
+    let edges: [[(to: Int, weight: Int)]] = (0 ..< vertexCount).map { _ in
+      (0 ..< 5).map { _ in
+        (Int.random(in: 0 ..< vertexCount, using: &rng),
+         Int.random(in: 1 ... 100, using: &rng))
+      }
+    }
+
+    // Reference distances from Bellman-Ford.
+    var expected = Array(repeating: Int.max, count: vertexCount)
+    expected[0] = 0
+    for _ in 0 ..< vertexCount {
+      for u in 0 ..< vertexCount where expected[u] != Int.max {
+        for (v, w) in edges[u] where expected[u] + w < expected[v] {
+          expected[v] = expected[u] + w
+        }
+      }
+    }
+
+    var distances = Array(repeating: Int.max, count: vertexCount)
+    var handles: [AddressableHeap<Tentative>.Handle?] =
+      Array(repeating: nil, count: vertexCount)
+    var queue = AddressableHeap<Tentative>()
+    distances[0] = 0
+    handles[0] = queue.insert(Tentative(distance: 0, vertex: 0))
+    while let next = queue.popMin() {
+      let u = next.vertex
+      handles[u] = nil
+      for (v, w) in edges[u] where distances[u] + w < distances[v] {
+        distances[v] = distances[u] + w
+        let item = Tentative(distance: distances[v], vertex: v)
+        if let handle = handles[v] {
+          queue.update(handle, to: item)
+        } else {
+          handles[v] = queue.insert(item)
+        }
+      }
+    }
+    expectEqual(distances, expected)
+  }
+}
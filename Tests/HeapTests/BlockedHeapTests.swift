@@ -0,0 +1,231 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import XCTest
+#if COLLECTIONS_SINGLE_MODULE
+import Collections
+#else
+import _CollectionsTestSupport
+import HeapModule
+#endif
+
+/// An integer wrapper with a larger stride, to get blocks of different
+/// heights. (`BlockedHeap` sizes its blocks based on the element's stride.)
+private struct Wide<Padding>: Comparable, CustomStringConvertible {
+  var value: Int
+  var padding: Padding
+
+  static func == (left: Self, right: Self) -> Bool {
+    left.value == right.value
+  }
+
+  static func < (left: Self, right: Self) -> Bool {
+    left.value < right.value
+  }
+
+  var description: String { "\(value)" }
+}
+
+extension BlockedHeap {
+  fileprivate func itemsInAscendingOrder() -> [Element] {
+    var copy = self
+    var result: [Element] = []
+    result.reserveCapacity(count)
+    while let next = copy.popMin() {
+      result.append(next)
+    }
+    return result
+  }
+}
+
+final class BlockedHeapTests: CollectionTestCase {
+  func test_empty() {
+    var heap = BlockedHeap<Int>()
+    expectTrue(heap.isEmpty)
+    expectEqual(heap.count, 0)
+    expectNil(heap.min)
+    expectNil(heap.max)
+    expectNil(heap.popMin())
+    expectNil(heap.popMax())
+    expectEqual(heap.description, "<0 items>")
+  }
+
+  func test_descriptions() {
+    let heap: BlockedHeap = [3, 1, 2]
+    expectEqual(heap.description, "<3 items>")
+    expectEqual(heap.debugDescription, "<3 items>")
+    expectEqual(BlockedHeap([1]).description, "<1 item>")
+  }
+
+  func _checkInsertPop<Padding>(padding: Padding) {
+    withEvery("c", in: [0, 1, 2, 3, 5, 15, 16, 17, 100, 500]) { c in
+      withEvery("seed", in: 0 ..< 3) { seed in
+        var rng = RepeatableRandomNumberGenerator(seed: seed)
+        var heap = BlockedHeap<Wide<Padding>>()
+        for value in (0 ..< c).shuffled(using: &rng) {
+          heap.insert(Wide(value: value, padding: padding))
+        }
+        expectEqual(heap.count, c)
+        expectEqualElements(heap.unordered.map { $0.value }.sorted(), 0 ..< c)
+        var lower = 0
+        var upper = c - 1
+        var takeMin = true
+        while !heap.isEmpty {
+          expectEqual(heap.min?.value, lower)
+          expectEqual(heap.max?.value, upper)
+          if takeMin {
+            expectEqual(heap.popMin()?.value, lower)
+            lower += 1
+          } else {
+            expectEqual(heap.popMax()?.value, upper)
+            upper -= 1
+          }
+          takeMin.toggle()
+        }
+        expectEqual(lower, upper + 1)
+      }
+    }
+  }
+
+  func test_insert_pop() {
+    _checkInsertPop(padding: ())
+    _checkInsertPop(padding: 0)
+    _checkInsertPop(padding: (0, 0, 0))
+    _checkInsertPop(padding: (0, 0, 0, 0, 0, 0, 0, 0))
+  }
+
+  func test_elementsWiderThanBlock() {
+    // A single element takes more than 128 bytes.
+    typealias Padding = (
+      (Int, Int, Int, Int, Int, Int, Int, Int),
+      (Int, Int, Int, Int, Int, Int, Int, Int))
+    let padding: Padding = (
+      (0, 0, 0, 0, 0, 0, 0, 0),
+      (0, 0, 0, 0, 0, 0, 0, 0))
+    expectGreaterThan(MemoryLayout<Wide<Padding>>.stride, 128)
+    _checkInsertPop(padding: padding)
+
+    withEvery("c", in: [0, 1, 2, 3, 4, 7, 8, 100]) { c in
+      var rng = RepeatableRandomNumberGenerator(seed: c)
+      let input = (0 ..< c).shuffled(using: &rng)
+      var heap = BlockedHeap(input.map { Wide(value: $0, padding: padding) })
+      expectEqual(heap.count, c)
+      expectEqualElements(heap.itemsInAscendingOrder().map { $0.value }, 0 ..< c)
+      heap.insert(contentsOf: input.map { Wide(value: $0, padding: padding) })
+      expectEqual(heap.count, 2 * c)
+      expectEqualElements(
+        heap.itemsInAscendingOrder().map { $0.value },
+        (0 ..< c).flatMap { [$0, $0] })
+    }
+  }
+
+  func test_init_sequence() {
+    withEvery("c", in: [0, 1, 2, 3, 10, 15, 16, 31, 100, 1000]) { c in
+      var rng = RepeatableRandomNumberGenerator(seed: c)
+      let input = (0 ..< c).shuffled(using: &rng)
+      let heap = BlockedHeap(input)
+      expectEqual(heap.count, c)
+      expectEqualElements(heap.itemsInAscendingOrder(), 0 ..< c)
+
+      let wide = BlockedHeap(input.map { Wide(value: $0, padding: (0, 0, 0)) })
+      expectEqualElements(wide.itemsInAscendingOrder().map { $0.value }, 0 ..< c)
+    }
+  }
+
+  func test_init_everySize() {
+    // Within a block, the internal nodes don't form a prefix of the storage,
+    // so check every size to cover every shape of a partially filled block.
+    withEvery("c", in: 1 ... 300) { c in
+      var rng = RepeatableRandomNumberGenerator(seed: c)
+      let input = (0 ..< c).shuffled(using: &rng)
+      let heap = BlockedHeap(input)
+      expectEqual(heap.min, 0)
+      expectEqual(heap.max, c - 1)
+      expectEqualElements(heap.itemsInAscendingOrder(), 0 ..< c)
+
+      var descending: [Int] = []
+      var copy = heap
+      while let next = copy.popMax() {
+        descending.append(next)
+      }
+      expectEqualElements(descending, (0 ..< c).reversed())
+
+      let wide = BlockedHeap(input.map { Wide(value: $0, padding: 0) })
+      expectEqual(wide.min?.value, 0)
+      expectEqual(wide.max?.value, c - 1)
+      expectEqualElements(wide.itemsInAscendingOrder().map { $0.value }, 0 ..< c)
+    }
+  }
+
+  func test_insert_contentsOf() {
+    withEvery("batch", in: [1, 7, 64, 1000]) { batch in
+      var rng = RepeatableRandomNumberGenerator(seed: batch)
+      let input = (0 ..< 2000).shuffled(using: &rng)
+      var heap = BlockedHeap<Int>()
+      var start = 0
+      while start < input.count {
+        let end = Swift.min(start + batch, input.count)
+        heap.insert(contentsOf: input[start ..< end])
+        start = end
+      }
+      expectEqualElements(heap.itemsInAscendingOrder(), 0 ..< input.count)
+    }
+  }
+
+  func test_replaceMin_replaceMax() {
+    withEvery("seed", in: 0 ..< 10) { seed in
+      var rng = RepeatableRandomNumberGenerator(seed: seed)
+      var heap = BlockedHeap<Int>()
+      var reference: [Int] = []
+      for _ in 0 ..< 300 {
+        let value = Int.random(in: 0 ..< 1000, using: &rng)
+        heap.insert(value)
+        reference.append(value)
+      }
+      for _ in 0 ..< 1000 {
+        let value = Int.random(in: 0 ..< 1000, using: &rng)
+        reference.sort()
+        if Bool.random(using: &rng) {
+          expectEqual(heap.replaceMin(with: value), reference.removeFirst())
+        } else {
+          expectEqual(heap.replaceMax(with: value), reference.removeLast())
+        }
+        reference.append(value)
+        expectEqual(heap.min, reference.min())
+        expectEqual(heap.max, reference.max())
+      }
+      expectEqualElements(heap.itemsInAscendingOrder(), reference.sorted())
+    }
+  }
+
+  func test_matchesHeap() {
+    withEvery("seed", in: 0 ..< 10) { seed in
+      var rng = RepeatableRandomNumberGenerator(seed: seed)
+      var blocked = BlockedHeap<Int>()
+      var heap = Heap<Int>()
+      for _ in 0 ..< 3000 {
+        switch Int.random(in: 0 ..< 8, using: &rng) {
+        case 0 ..< 4:
+          let value = Int.random(in: 0 ..< 500, using: &rng)
+          blocked.insert(value)
+          heap.insert(value)
+        case 4, 5:
+          expectEqual(blocked.popMin(), heap.popMin())
+        default:
+          expectEqual(blocked.popMax(), heap.popMax())
+        }
+        expectEqual(blocked.count, heap.count)
+        expectEqual(blocked.min, heap.min)
+        expectEqual(blocked.max, heap.max)
+      }
+    }
+  }
+}
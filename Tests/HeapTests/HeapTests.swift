@@ -174,6 +174,143 @@ final class HeapTests: CollectionTestCase {
     }
   }
 
+  func test_insert_contentsOf_batches() {
+    withEvery("origCount", in: [0, 1, 2, 5, 31, 32, 33, 100, 1000]) { origCount in
+      withEvery("newCount", in: [0, 1, 2, 7, 8, 20, 64, 500, 3000]) { newCount in
+        withEvery("seed", in: 0 ..< 3) { seed in
+          var rng = RepeatableRandomNumberGenerator(seed: seed)
+          let input = (0 ..< origCount + newCount).shuffled(using: &rng)
+          var heap = Heap(input[..<origCount])
+          heap.insert(contentsOf: input[origCount...])
+          expectEqual(heap.count, input.count)
+          expectEqualElements(heap.itemsInAscendingOrder(), 0 ..< input.count)
+        }
+      }
+    }
+  }
+
+  func test_insert_contentsOf_descendingBatch() {
+    // Every new item needs to bubble all the way up to the root.
+    var heap = Heap(1000 ..< 2000)
+    heap.insert(contentsOf: (0 ..< 1000).reversed())
+    expectEqual(heap.min, 0)
+    expectEqual(heap.max, 1999)
+    expectEqualElements(heap.itemsInAscendingOrder(), 0 ..< 2000)
+  }
+
+  func test_merge() {
+    withEvery("c1", in: [0, 1, 2, 3, 10, 50, 200]) { c1 in
+      withEvery("c2", in: [0, 1, 2, 3, 10, 50, 200]) { c2 in
+        var rng = RepeatableRandomNumberGenerator(seed: c1 * 1000 + c2)
+        let input = (0 ..< c1 + c2).shuffled(using: &rng)
+        var heap = Heap(input[..<c1])
+        let other = Heap(input[c1...])
+        heap.merge(other)
+        expectEqual(heap.count, c1 + c2)
+        expectEqual(other.count, c2)
+        expectEqualElements(heap.itemsInAscendingOrder(), 0 ..< c1 + c2)
+      }
+    }
+  }
+
+  func test_merge_duplicates() {
+    var heap: Heap = [3, 3, 1, 2]
+    heap.merge(heap)
+    expectEqualElements(heap.itemsInAscendingOrder(), [1, 1, 2, 2, 3, 3, 3, 3])
+  }
+
+  func test_insert_keepingLargest() {
+    withEvery("k", in: [0, 1, 2, 5, 16, 100]) { k in
+      withEvery("seed", in: 0 ..< 5) { seed in
+        var rng = RepeatableRandomNumberGenerator(seed: seed)
+        let input = (0 ..< 200).map { _ in Int.random(in: 0 ..< 50, using: &rng) }
+        var heap = Heap<Int>()
+        var dropped: [Int] = []
+        for value in input {
+          if let d = heap.insert(value, keepingLargest: k) {
+            dropped.append(d)
+          }
+          expectLessThanOrEqual(heap.count, k)
+        }
+        let expected = input.sorted().suffix(k)
+        expectEqualElements(heap.itemsInAscendingOrder(), expected)
+        expectEqualElements(
+          (dropped + expected).sorted(), input.sorted())
+      }
+    }
+  }
+
+  func test_insert_keepingSmallest() {
+    withEvery("k", in: [0, 1, 2, 5, 16, 100]) { k in
+      withEvery("seed", in: 0 ..< 5) { seed in
+        var rng = RepeatableRandomNumberGenerator(seed: seed)
+        let input = (0 ..< 200).map { _ in Int.random(in: 0 ..< 50, using: &rng) }
+        var heap = Heap<Int>()
+        var dropped: [Int] = []
+        for value in input {
+          if let d = heap.insert(value, keepingSmallest: k) {
+            dropped.append(d)
+          }
+          expectLessThanOrEqual(heap.count, k)
+        }
+        let expected = input.sorted().prefix(k)
+        expectEqualElements(heap.itemsInAscendingOrder(), expected)
+        expectEqualElements(
+          (dropped + expected).sorted(), input.sorted())
+      }
+    }
+  }
+
+  func test_insert_keeping_trimsOversizedHeap() {
+    var heap = Heap(0 ..< 10)
+    expectEqual(heap.insert(20, keepingLargest: 3), 7)
+    expectEqualElements(heap.itemsInAscendingOrder(), [8, 9, 20])
+
+    heap = Heap(0 ..< 10)
+    expectEqual(heap.insert(-1, keepingSmallest: 3), 2)
+    expectEqualElements(heap.itemsInAscendingOrder(), [-1, 0, 1])
+  }
+
+  func test_topK() {
+    withEvery("k", in: [0, 1, 2, 3, 10, 99, 100, 101, 500]) { k in
+      withEvery("seed", in: 0 ..< 5) { seed in
+        var rng = RepeatableRandomNumberGenerator(seed: seed)
+        let input = (0 ..< 100).map { _ in Int.random(in: 0 ..< 1000, using: &rng) }
+        let heap = Heap.topK(k, of: input)
+        expectEqualElements(
+          heap.itemsInAscendingOrder(), input.sorted().suffix(k))
+      }
+    }
+  }
+
+  func test_insert_contentsOf_keepingLargest() {
+    withEvery("initial", in: [0, 1, 5, 20]) { initial in
+      withEvery("k", in: [0, 1, 4, 10, 30]) { k in
+        var heap = Heap((0 ..< initial).map { $0 * 10 })
+        let input = (0 ..< 50).map { ($0 * 37) % 101 }
+        heap.insert(contentsOf: input, keepingLargest: k)
+        let all = (0 ..< initial).map { $0 * 10 } + input
+        expectEqualElements(heap.itemsInAscendingOrder(), all.sorted().suffix(k))
+      }
+    }
+  }
+
+  func test_init_parallelizing() {
+    withEvery("c", in: [0, 1, 2, 100, 40_000, 300_000]) { c in
+      var rng = RepeatableRandomNumberGenerator(seed: c)
+      let input = (0 ..< c).shuffled(using: &rng)
+      let heap = Heap(parallelizing: input)
+      expectEqual(heap.count, c)
+      expectEqualElements(heap.itemsInAscendingOrder(), 0 ..< c)
+    }
+  }
+
+  func test_init_parallelizing_duplicates() {
+    let input = (0 ..< 100_000).map { ($0 * 7919) % 1000 }
+    let heap = Heap(parallelizing: input)
+    expectEqualElements(heap.itemsInAscendingOrder(), input.sorted())
+  }
+
   func test_min() {
     var heap = Heap<Int>()
     expectNil(heap.min)
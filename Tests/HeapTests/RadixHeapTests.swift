@@ -0,0 +1,152 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+import XCTest
+#if COLLECTIONS_SINGLE_MODULE
+import Collections
+#else
+import _CollectionsTestSupport
+import HeapModule
+#endif
+
+final class RadixHeapTests: CollectionTestCase {
+  func test_empty() {
+    var heap = RadixHeap<UInt, String>()
+    expectTrue(heap.isEmpty)
+    expectEqual(heap.count, 0)
+    expectNil(heap.min)
+    expectNil(heap.popMin())
+    expectEqual(heap.lowerBound, 0)
+    expectEqual(heap.description, "<0 items>")
+  }
+
+  func test_insert_pop() {
+    withEvery("c", in: [0, 1, 2, 10, 100, 1000]) { c in
+      var rng = RepeatableRandomNumberGenerator(seed: c)
+      let keys = (0 ..< c).map { _ in UInt32.random(in: 0 ... .max, using: &rng) }
+      var heap = RadixHeap<UInt32, Int>()
+      for (i, key) in keys.enumerated() {
+        heap.insert(key: key, value: i)
+      }
+      expectEqual(heap.count, c)
+      var popped: [UInt32] = []
+      while let item = heap.popMin() {
+        expectEqual(keys[item.value], item.key)
+        expectEqual(heap.lowerBound, item.key)
+        popped.append(item.key)
+      }
+      expectEqual(popped, keys.sorted())
+      expectTrue(heap.isEmpty)
+    }
+  }
+
+  func test_min() {
+    var heap = RadixHeap<UInt8, Character>()
+    heap.insert(key: 42, value: "a")
+    heap.insert(key: 7, value: "b")
+    heap.insert(key: 200, value: "c")
+    expectEqual(heap.min?.key, 7)
+    expectEqual(heap.min?.value, "b")
+    expectEqual(heap.removeMin().key, 7)
+    expectEqual(heap.min?.key, 42)
+    expectEqual(heap.removeMin().value, "a")
+    heap.insert(key: 42, value: "d")
+    expectEqual(heap.min?.key, 42)
+    expectEqual(heap.removeMin().value, "d")
+    expectEqual(heap.removeMin().value, "c")
+    expectNil(heap.min)
+  }
+
+  func test_extremeKeys() {
+    var heap = RadixHeap<UInt8, Int>()
+    for key in (0 ... UInt8.max).reversed() {
+      heap.insert(key: key, value: Int(key))
+    }
+    heap.insert(key: .max, value: 256)
+    heap.insert(key: 0, value: -1)
+    var keys: [UInt8] = []
+    while let item = heap.popMin() {
+      keys.append(item.key)
+    }
+    expectEqual(keys, [0] + Array(0 ... UInt8.max) + [.max])
+  }
+
+  func test_signedKeys() {
+    var heap = RadixHeap<Int8, Int>()
+    expectEqual(heap.lowerBound, .min)
+    let keys: [Int8] = [5, -128, 127, -1, 0, -50, 50, -1]
+    for key in keys {
+      heap.insert(key: key, value: 0)
+    }
+    var popped: [Int8] = []
+    while let item = heap.popMin() {
+      popped.append(item.key)
+      if item.key == -1 && item.value == 0 {
+        heap.insert(key: -1, value: 1)
+        heap.insert(key: 100, value: 2)
+      }
+    }
+    expectEqual(popped, [-128, -50, -1, -1, -1, -1, 0, 5, 50, 100, 100, 127])
+  }
+
+  func test_monotoneWorkload() {
+    withEvery("seed", in: 0 ..< 10) { seed in
+      var rng = RepeatableRandomNumberGenerator(seed: seed)
+      var heap = RadixHeap<UInt64, Int>()
+      var reference = Heap<UInt64>()
+      for i in 0 ..< 100 {
+        let key = UInt64.random(in: 0 ..< 1000, using: &rng)
+        heap.insert(key: key, value: i)
+        reference.insert(key)
+      }
+      for i in 0 ..< 5000 {
+        if Int.random(in: 0 ..< 3, using: &rng) == 0 {
+          let item = heap.popMin()
+          expectEqual(item?.key, reference.popMin())
+        } else {
+          let key = heap.lowerBound + UInt64.random(in: 0 ..< 100, using: &rng)
+          heap.insert(key: key, value: i)
+          reference.insert(key)
+        }
+        expectEqual(heap.count, reference.count)
+        expectEqual(heap.min?.key, reference.min)
+      }
+    }
+  }
+
+  func test_removeAll() {
+    withEvery("keepCapacity", in: [false, true]) { keepCapacity in
+      var heap = RadixHeap((0 ..< 100).map { (key: UInt16($0), value: $0) })
+      expectEqual(heap.removeMin().key, 0)
+      expectEqual(heap.removeMin().key, 1)
+      heap.removeAll(keepingCapacity: keepCapacity)
+      expectTrue(heap.isEmpty)
+      expectEqual(heap.lowerBound, 0)
+      heap.insert(key: 0, value: 42)
+      expectEqual(heap.popMin()?.value, 42)
+    }
+  }
+
+  func test_payloadLifetimes() {
+    withLifetimeTracking { tracker in
+      var heap = RadixHeap<UInt, LifetimeTracked<Int>>()
+      for i in 0 ..< 50 {
+        heap.insert(key: UInt(i % 7), value: tracker.instance(for: i))
+      }
+      for _ in 0 ..< 20 {
+        heap.removeMin()
+      }
+      expectEqual(tracker.instances, 30)
+      heap.removeAll()
+      expectEqual(tracker.instances, 0)
+    }
+  }
+}
@@ -135,6 +135,44 @@ final class BTreeTests: CollectionTestCase {
     }
   }
   
+  func test_nodeCapacities() {
+    func capacities(
+      _ tree: _BTree<Int, Int>
+    ) -> (leaf: Int, inner: Int?) {
+      var node = tree.root
+      var internalCapacity: Int? = nil
+      while !node.read({ $0.isLeaf }) {
+        internalCapacity = node.read { $0.capacity }
+        node = node.read { $0[childAt: 0] }
+      }
+      return (node.read { $0.capacity }, internalCapacity)
+    }
+
+    var d = SortedDictionary<Int, Int>(leafCapacity: 32, internalCapacity: 8)
+    for i in 0 ..< 1000 {
+      d[i] = 2 * i
+    }
+    d._root.checkInvariants()
+    expectEqual(capacities(d._root).leaf, 32)
+    expectEqual(capacities(d._root).inner, 8)
+
+    let filtered = d.filter { $0.key % 3 == 0 }
+    expectEqual(filtered._root.leafCapacity, 32)
+    expectEqual(filtered._root.internalCapacity, 8)
+
+    d.removeAll()
+    expectEqual(capacities(d._root).leaf, 32)
+    d[1] = 2
+    expectEqual(d[1], 2)
+
+    let sorted = SortedDictionary(
+      sortedKeysWithValues: (0 ..< 1000).map { (key: $0, value: $0) },
+      leafCapacity: 128,
+      internalCapacity: 16)
+    expectEqual(capacities(sorted._root).leaf, 128)
+    expectEqual(capacities(sorted._root).inner, 16)
+  }
+  
   func test_randomInsertionOrder() {
     let kvs = [
       (key: 71, value: 142),
@@ -171,5 +209,112 @@ final class BTreeTests: CollectionTestCase {
       tree.updateAnyValue(value, forKey: key)
     }
   }
+
+  func test_findAnyValuesForSortedKeys() {
+    withEvery("capacity", in: [2, 3, 4, 5, 16]) { capacity in
+      withEvery("size", in: [0, 1, 5, 50, 300]) { size in
+        var tree = _BTree<Int, Int>(capacity: capacity)
+        for i in 0..<size {
+          tree.updateAnyValue(-i, forKey: 3 * i)
+        }
+        func expected(_ key: Int) -> Int? {
+          key >= 0 && key % 3 == 0 && key < 3 * size ? -key / 3 : nil
+        }
+
+        withEvery("stride", in: [1, 2, 7, 40]) { stride in
+          let keys = Array(Swift.stride(from: -5, to: 3 * size + 5, by: stride))
+          expectEqualElements(
+            tree.findAnyValues(forSortedKeys: keys),
+            keys.map(expected))
+        }
+
+        // Repeated keys and sparse batches must also be found.
+        let keys = [-1, 0, 0, 3, 3, 3 * (size / 2), 3 * (size / 2), 3 * size]
+          .sorted()
+        expectEqualElements(
+          tree.findAnyValues(forSortedKeys: keys),
+          keys.map(expected))
+      }
+    }
+  }
+
+  /// Returns the number of elements in each leaf of the tree, in order.
+  private func leafCounts(_ node: _Node<Int, Int>) -> [Int] {
+    node.read { handle in
+      if handle.isLeaf { return [handle.elementCount] }
+      return (0..<handle.childCount).flatMap { leafCounts(handle[childAt: $0]) }
+    }
+  }
+
+  func test_ascendingInsertionsFillLeaves() {
+    withEvery("capacity", in: [2, 3, 4, 5, 16]) { capacity in
+      withEvery("size", in: [0, 1, 10, 100, 500]) { size in
+        withEvery("appending", in: [false, true]) { appending in
+          var tree = _BTree<Int, Int>(capacity: capacity)
+          for i in 0..<size {
+            if appending {
+              tree.append((key: i, value: -i))
+            } else {
+              tree.updateAnyValue(-i, forKey: i)
+            }
+          }
+          tree.checkInvariants()
+          expectEqual(tree.count, size)
+          expectEqualElements(tree, (0..<size).map { (key: $0, value: -$0) })
+
+          // All leaves but the last one are missing at most one element.
+          let counts = leafCounts(tree.root)
+          for count in counts.dropLast() {
+            expectGreaterThanOrEqual(count, capacity - 1)
+          }
+        }
+      }
+    }
+  }
+
+  func test_ascendingInsertionsThenMutations() {
+    withEvery("seed", in: 0..<10) { seed in
+      var rng = RepeatableRandomNumberGenerator(seed: seed)
+      var tree = _BTree<Int, Int>(capacity: 4)
+      var reference: [Int] = []
+      for i in 0..<200 {
+        tree.append((key: 2 * i, value: 0))
+        reference.append(2 * i)
+
+        switch Int.random(in: 0..<4, using: &rng) {
+        case 0:
+          // Remove from near the end, where the last leaf may be underfull.
+          let key = reference[Int.random(
+            in: Swift.max(0, reference.count - 6)..<reference.count,
+            using: &rng)]
+          tree.removeAnyElement(forKey: key)
+          reference.removeAll { $0 == key }
+        case 1:
+          // Insert in between existing keys.
+          let key = 2 * Int.random(in: 0...i, using: &rng) + 1
+          if !reference.contains(key) {
+            tree.updateAnyValue(0, forKey: key)
+            reference.append(key)
+            reference.sort()
+          }
+        default:
+          break
+        }
+        tree.checkInvariants()
+        expectEqualElements(tree.map { $0.key }, reference)
+      }
+
+      // Appending another tree must rebalance the last leaf first.
+      var other = _BTree<Int, Int>(capacity: 4)
+      for i in 0..<50 {
+        other.append((key: 1000 + i, value: 0))
+      }
+      tree.append(contentsOf: other)
+      tree.checkInvariants()
+      expectEqualElements(
+        tree.map { $0.key },
+        reference + (1000..<1050))
+    }
+  }
 }
 #endif
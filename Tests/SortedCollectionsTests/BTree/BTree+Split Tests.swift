@@ -0,0 +1,182 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if DEBUG
+import _CollectionsTestSupport
+@_spi(Testing) @testable import SortedCollections
+
+final class BTreeSplitTests: CollectionTestCase {
+  func test_split() {
+    withEvery("capacity", in: [2, 3, 4, 5]) { capacity in
+      withEvery("size", in: [0, 1, 2, 5, 10, 50, 130]) { size in
+        var builder = _BTree<Int, Int>.Builder(capacity: capacity)
+        for i in 0..<size {
+          builder.append((2 * i, -i))
+        }
+        let tree = builder.finish()
+
+        withEvery("key", in: -1...(2 * size)) { key in
+          let (lower, upper) = tree.split(atKey: key)
+          lower.checkInvariants()
+          upper.checkInvariants()
+
+          let split = (key + 1) / 2
+          expectEqual(lower.count, split)
+          expectEqual(upper.count, size - split)
+          expectEqualElements(
+            lower.map { $0.key },
+            (0..<split).map { 2 * $0 })
+          expectEqualElements(
+            upper.map { $0.key },
+            (split..<size).map { 2 * $0 })
+
+          // Splitting must not affect the original tree.
+          expectEqual(tree.count, size)
+          expectEqualElements(tree.map { $0.key }, (0..<size).map { 2 * $0 })
+        }
+      }
+    }
+  }
+
+  func test_append() {
+    withEvery("capacity", in: [2, 3, 4, 5]) { capacity in
+      withEvery("leftSize", in: [0, 1, 3, 10, 100]) { leftSize in
+        withEvery("rightSize", in: [0, 1, 3, 10, 100]) { rightSize in
+          var left = _BTree<Int, Int>(capacity: capacity)
+          for i in 0..<leftSize {
+            left.updateAnyValue(-i, forKey: i)
+          }
+          var right = _BTree<Int, Int>(capacity: capacity)
+          for i in leftSize..<(leftSize + rightSize) {
+            right.updateAnyValue(-i, forKey: i)
+          }
+
+          left.append(contentsOf: right)
+          left.checkInvariants()
+          expectEqualElements(
+            left,
+            (0..<(leftSize + rightSize)).map { (key: $0, value: -$0) })
+
+          expectEqual(right.count, rightSize)
+          expectEqualElements(
+            right.map { $0.key },
+            leftSize..<(leftSize + rightSize))
+        }
+      }
+    }
+  }
+
+  func test_append_mismatchedCapacities() {
+    var left = _BTree<Int, Int>(capacity: 4)
+    for i in 0..<50 {
+      left.updateAnyValue(-i, forKey: i)
+    }
+    var right = _BTree<Int, Int>(capacity: 7)
+    for i in 50..<100 {
+      right.updateAnyValue(-i, forKey: i)
+    }
+    left.append(contentsOf: right)
+    left.checkInvariants()
+    expectEqualElements(left, (0..<100).map { (key: $0, value: -$0) })
+  }
+
+  func test_splitThenAppend() {
+    withEvery("seed", in: 0..<10) { seed in
+      var rng = RepeatableRandomNumberGenerator(seed: seed)
+      var tree = _BTree<Int, Int>(capacity: 4)
+      for i in 0..<500 {
+        tree.updateAnyValue(-i, forKey: i)
+      }
+      for _ in 0..<20 {
+        let key = Int.random(in: -10...510, using: &rng)
+        let (lower, upper) = tree.split(atKey: key)
+        var joined = lower
+        joined.append(contentsOf: upper)
+        tree = joined
+        upper.checkInvariants()
+        tree.checkInvariants()
+        expectEqual(tree.count, 500)
+        expectEqualElements(tree, (0..<500).map { (key: $0, value: -$0) })
+      }
+    }
+  }
+
+  func test_extractElements() {
+    let size = 60
+    let bounds: [_BTree<Int, Int>.KeyBound?] = [
+      nil,
+      (key: -5, isInclusive: true),
+      (key: 0, isInclusive: false),
+      (key: 10, isInclusive: true),
+      (key: 10, isInclusive: false),
+      (key: 31, isInclusive: true),
+      (key: 2 * size, isInclusive: false),
+    ]
+    withEvery("capacity", in: [2, 4, 5]) { capacity in
+      withEvery("lower", in: bounds.indices) { l in
+        withEvery("upper", in: bounds.indices) { u in
+          let lower = bounds[l]
+          let upper = bounds[u]
+          if let lower = lower, let upper = upper, lower.key > upper.key {
+            return
+          }
+          
+          func isExtracted(_ key: Int) -> Bool {
+            if let lower = lower {
+              if key < lower.key { return false }
+              if key == lower.key && !lower.isInclusive { return false }
+            }
+            if let upper = upper {
+              if key > upper.key { return false }
+              if key == upper.key && !upper.isInclusive { return false }
+            }
+            return true
+          }
+          
+          var tree = _BTree<Int, Int>(capacity: capacity)
+          for i in 0..<size {
+            tree.updateAnyValue(-i, forKey: 2 * i)
+          }
+          let original = tree
+          let extracted = tree.extractElements(from: lower, to: upper)
+          tree.checkInvariants()
+          extracted.checkInvariants()
+          
+          let keys = (0..<size).map { 2 * $0 }
+          expectEqualElements(
+            extracted.map { $0.key }, keys.filter { isExtracted($0) })
+          expectEqualElements(
+            tree.map { $0.key }, keys.filter { !isExtracted($0) })
+          expectEqualElements(original.map { $0.key }, keys)
+        }
+      }
+    }
+  }
+  
+  func test_removeSubrange() {
+    withEvery("size", in: [1, 2, 10, 50]) { size in
+      withEvery("start", in: 0...size) { start in
+        withEvery("end", in: start...size) { end in
+          btreeOfSize(size) { tree, kvs in
+            let range = tree.index(atOffset: start)..<tree.index(atOffset: end)
+            tree.removeSubrange(range)
+            tree.checkInvariants()
+            expectEqual(tree.count, size - (end - start))
+            expectEqualElements(
+              tree.map { $0.key },
+              Array(0..<start) + Array(end..<size))
+          }
+        }
+      }
+    }
+  }
+}
+#endif
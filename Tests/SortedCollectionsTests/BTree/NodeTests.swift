@@ -141,5 +141,95 @@ final class NodeTests: CollectionTestCase {
       }
     }
   }
+  
+  /// Checks the slots found in leaves of sorted keys with duplicates against
+  /// a linear search.
+  func checkSlots<Key: Comparable>(
+    of type: Key.Type,
+    _ makeKey: (Int) -> Key
+  ) {
+    withEvery("count", in: [0, 1, 7, 8, 9, 16, 31, 64, 65, 130, 300]) { count in
+      // Every third key appears twice.
+      let keys = (0..<count).map { makeKey(2 * ($0 - $0 / 3)) }
+      let node = _Node<Key, Void>(
+        _keyValuePairs: keys.map { (key: $0, value: ()) },
+        capacity: Swift.max(count, 1))
+      
+      node.read { handle in
+        for probe in -1 ... 2 * count {
+          let key = makeKey(probe)
+          expectEqual(
+            handle.startSlot(forKey: key),
+            keys.firstIndex(where: { $0 >= key }) ?? count)
+          expectEqual(
+            handle.endSlot(forKey: key),
+            keys.firstIndex(where: { $0 > key }) ?? count)
+        }
+      }
+    }
+  }
+  
+  func test_slotsOfVectorizableKeys() {
+    checkSlots(of: Int.self) { $0 }
+    checkSlots(of: Int32.self) { Int32($0) }
+    checkSlots(of: UInt64.self) { UInt64($0 + 1) }
+    checkSlots(of: UInt32.self) { UInt32($0 + 1) }
+    checkSlots(of: Double.self) { Double($0) / 2 }
+    checkSlots(of: Float.self) { Float($0) - 0.5 }
+    checkSlots(of: String.self) { String(1000 + $0) }
+  }
+  
+  func checkTailLayout<Key: Comparable, Value>(
+    of: Key.Type, _: Value.Type, capacity: Int, isLeaf: Bool
+  ) {
+    let node = _Node<Key, Value>(withCapacity: capacity, isLeaf: isLeaf)
+    node.read { handle in
+      var end = UnsafeRawPointer(handle.keys + capacity)
+      if let values = handle.values {
+        expectGreaterThanOrEqual(UnsafeRawPointer(values), end)
+        expectEqual(
+          Int(bitPattern: values) % MemoryLayout<Value>.alignment, 0)
+        end = UnsafeRawPointer(values + capacity)
+      }
+      if let children = handle.children {
+        expectGreaterThanOrEqual(UnsafeRawPointer(children), end)
+        expectEqual(
+          Int(bitPattern: children) % MemoryLayout<_Node<Key, Value>>.alignment,
+          0)
+      }
+      expectEqual(handle.values == nil, !_Node<Key, Value>.hasValues)
+      expectEqual(handle.children == nil, isLeaf)
+    }
+  }
+  
+  func test_tailAllocatedBuffers() {
+    withEvery("capacity", in: [1, 2, 3, 7, 16]) { capacity in
+      withEvery("isLeaf", in: [false, true]) { isLeaf in
+        checkTailLayout(
+          of: UInt8.self, Double.self, capacity: capacity, isLeaf: isLeaf)
+        checkTailLayout(
+          of: UInt8.self, String.self, capacity: capacity, isLeaf: isLeaf)
+        checkTailLayout(
+          of: Int.self, UInt8.self, capacity: capacity, isLeaf: isLeaf)
+        checkTailLayout(
+          of: String.self, Void.self, capacity: capacity, isLeaf: isLeaf)
+      }
+    }
+  }
+  
+  func test_tailAllocatedBuffersHoldElements() {
+    var tree = _BTree<UInt8, String>(capacity: 3)
+    for key in (0 ... 200 as ClosedRange<UInt8>).reversed() {
+      tree.updateAnyValue(String(key), forKey: key)
+    }
+    let copy = tree
+    for key in 0 ... 100 as ClosedRange<UInt8> {
+      tree.removeAnyElement(forKey: key)
+    }
+    expectEqual(tree.count, 100)
+    expectEqualElements(copy.map { $0.key }, 0 ... 200)
+    expectEqualElements(copy.map { $0.value }, (0 ... 200).map { String($0) })
+    expectEqualElements(tree.map { $0.key }, 101 ... 200)
+  }
 }
 #endif
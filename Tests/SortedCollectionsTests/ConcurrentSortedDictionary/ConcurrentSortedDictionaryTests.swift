@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if compiler(>=6.0) && canImport(Synchronization)
+import XCTest
+import Foundation
+import _CollectionsTestSupport
+import SortedCollections
+
+final class ConcurrentSortedDictionaryTests: CollectionTestCase {
+  func test_updateAndSnapshot() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    let d = ConcurrentSortedDictionary<Int, Int>([1: 10, 2: 20])
+    let before = d.snapshot()
+
+    let removed = d.update { dictionary -> Int? in
+      dictionary[3] = 30
+      return dictionary.removeValue(forKey: 1)
+    }
+    expectEqual(removed, 10)
+
+    expectEqualElements(before.map { $0.key }, [1, 2])
+    expectEqualElements(d.snapshot().map { $0.key }, [2, 3])
+    expectNil(d[1])
+    expectEqual(d[2], 20)
+    expectEqual(d[3], 30)
+
+    d.store([:])
+    expectTrue(d.snapshot().isEmpty)
+    expectEqual(before.count, 2)
+  }
+
+  func test_snapshotsAreUnaffectedByLaterUpdates() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    withLifetimeTracking { tracker in
+      let d = ConcurrentSortedDictionary<Int, LifetimeTracked<Int>>()
+      var snapshots: [SortedDictionary<Int, LifetimeTracked<Int>>] = []
+      for i in 0 ..< 100 {
+        d.update { $0[i] = tracker.instance(for: i) }
+        if i % 10 == 0 {
+          d.update { $0[i / 2] = nil }
+        }
+        snapshots.append(d.snapshot())
+      }
+      var expected: [Int] = []
+      for (i, snapshot) in snapshots.enumerated() {
+        expected.append(i)
+        if i % 10 == 0 {
+          expected.removeAll { $0 == i / 2 }
+        }
+        expectEqualElements(snapshot.map { $0.key }, expected)
+        expectEqualElements(snapshot.map { $0.value.payload }, expected)
+      }
+    }
+  }
+
+  func test_readersSeeConsistentVersions() throws {
+    guard #available(macOS 15.0, iOS 18.0, watchOS 11.0, tvOS 18.0, visionOS 2.0, *) else {
+      throw XCTSkip("Requires Synchronization")
+    }
+    let count = 2_000
+    let readerCount = 4
+    let d = ConcurrentSortedDictionary<Int, Int>()
+
+    let readersDone = DispatchSemaphore(value: 0)
+    for _ in 0 ..< readerCount {
+      let reader = Thread {
+        // Every version holds the keys `0 ..< n` for some `n`, and the sum
+        // of their values is zero.
+        var latest = 0
+        while latest < count {
+          let snapshot = d.snapshot()
+          precondition(snapshot.count >= latest, "Went back in time")
+          latest = snapshot.count
+          var sum = 0
+          for (offset, element) in snapshot.enumerated() {
+            precondition(element.key == offset, "Inconsistent snapshot")
+            sum += element.value
+          }
+          precondition(sum == 0, "Partial update")
+          if latest > 0 {
+            precondition(d[latest - 1] != nil, "Missing key")
+          }
+        }
+        readersDone.signal()
+      }
+      reader.start()
+    }
+
+    for i in 0 ..< count {
+      d.update { dictionary in
+        dictionary[i] = i
+        dictionary[0, default: 0] -= i
+      }
+    }
+    for _ in 0 ..< readerCount {
+      readersDone.wait()
+    }
+
+    let result = d.snapshot()
+    expectEqual(result.count, count)
+    expectEqual(result.reduce(0) { $0 + $1.value }, 0)
+  }
+}
+#endif
@@ -10,7 +10,11 @@
 //===----------------------------------------------------------------------===//
 
 import XCTest
+#if DEBUG // Some of these tests check internal decls
+@_spi(Testing) @testable import SortedCollections
+#else
 @_spi(Testing) import SortedCollections
+#endif
 import _CollectionsTestSupport
 
 class SortedSetTests: CollectionTestCase {
@@ -26,6 +30,30 @@ class SortedSetTests: CollectionTestCase {
     }
   }
 
+  func test_init_nodeCapacities() {
+    withEvery("capacity", in: [4, 7, 64, 512]) { capacity in
+      var rng = RepeatableRandomNumberGenerator(seed: capacity)
+      var set = SortedSet<Int>(leafCapacity: capacity, internalCapacity: capacity)
+      for value in (0 ..< 1000).shuffled(using: &rng) {
+        set.insert(value)
+      }
+      expectEqualElements(set, 0 ..< 1000)
+      for value in stride(from: 0, to: 1000, by: 2) {
+        expectEqual(set.remove(value), value)
+      }
+      expectEqualElements(set, stride(from: 1, to: 1000, by: 2))
+
+      let sorted = SortedSet(
+        sortedElements: 0 ..< 1000, leafCapacity: capacity, internalCapacity: 4)
+      expectEqualElements(sorted, 0 ..< 1000)
+      expectEqualElements(sorted.subtracting(set), stride(from: 0, to: 1000, by: 2))
+
+      set.removeAll()
+      set.insert(42)
+      expectEqualElements(set, [42])
+    }
+  }
+
   func test_init_empty() {
     let set = SortedSet<Int>()
     expectEqual(set.count, 0)
@@ -445,4 +473,80 @@ class SortedSetTests: CollectionTestCase {
       }
     }
   }
+
+  func test_setAlgebra_unbalancedSizes() {
+    // Exercises the lookup-based paths taken when one operand is much smaller
+    // than the other.
+    withEvery("small", in: [0, 1, 2, 5, 20]) { small in
+      withEvery("large", in: [100, 1000]) { large in
+        withEvery("seed", in: 0 ..< 3) { seed in
+          var rng = RepeatableRandomNumberGenerator(seed: seed)
+          let r1 = (0 ..< small).map { _ in Int.random(in: 0 ..< 2 * large, using: &rng) }
+          let r2 = (0 ..< large).map { _ in Int.random(in: 0 ..< 2 * large, using: &rng) }
+          let s1 = Set(r1)
+          let s2 = Set(r2)
+          let a = SortedSet(r1)
+          let b = SortedSet(r2)
+
+          expectEqualElements(a.union(b), s1.union(s2).sorted())
+          expectEqualElements(b.union(a), s1.union(s2).sorted())
+          expectEqualElements(a.intersection(b), s1.intersection(s2).sorted())
+          expectEqualElements(b.intersection(a), s1.intersection(s2).sorted())
+          expectEqualElements(
+            a.symmetricDifference(b), s1.symmetricDifference(s2).sorted())
+          expectEqualElements(
+            b.symmetricDifference(a), s1.symmetricDifference(s2).sorted())
+          expectEqualElements(a.subtracting(b), s1.subtracting(s2).sorted())
+          expectEqualElements(b.subtracting(a), s2.subtracting(s1).sorted())
+          expectEqual(a.isSubset(of: b), s1.isSubset(of: s2))
+          expectEqual(a.isDisjoint(with: b), s1.isDisjoint(with: s2))
+          expectEqual(b.isDisjoint(with: a), s1.isDisjoint(with: s2))
+
+          // The originals must not be affected by the copies.
+          expectEqualElements(a, s1.sorted())
+          expectEqualElements(b, s2.sorted())
+
+          var c = b
+          c.formSymmetricDifference(a)
+          c.formSymmetricDifference(a)
+          expectEqualElements(c, s2.sorted())
+        }
+      }
+    }
+  }
+
+  #if DEBUG
+  func test_setAlgebra_keepsNodeCapacities() {
+    // Results derived from a set keep its node capacities, even when the
+    // other operand is much larger.
+    withEvery("small", in: [0, 1, 5]) { small in
+      var a = SortedSet<Int>(leafCapacity: 4, internalCapacity: 5)
+      for value in 0 ..< small {
+        a.insert(3 * value)
+      }
+      let b = SortedSet(0 ..< 1000)
+
+      func check(_ result: SortedSet<Int>, _ capacities: (Int, Int)) {
+        expectEqual(result._root.leafCapacity, capacities.0)
+        expectEqual(result._root.internalCapacity, capacities.1)
+        result._root.checkInvariants()
+      }
+      let aCapacities = (4, 5)
+      let bCapacities = (b._root.leafCapacity, b._root.internalCapacity)
+      check(a.union(b), aCapacities)
+      check(b.union(a), bCapacities)
+      check(a.intersection(b), aCapacities)
+      check(b.intersection(a), bCapacities)
+      check(a.symmetricDifference(b), aCapacities)
+      check(b.symmetricDifference(a), bCapacities)
+      check(a.subtracting(b), aCapacities)
+      check(b.subtracting(a), bCapacities)
+
+      var c = a
+      c.formUnion(b)
+      check(c, aCapacities)
+      expectEqualElements(c, 0 ..< 1000)
+    }
+  }
+  #endif
 }
@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+#if DEBUG
+import _CollectionsTestSupport
+@testable import SortedCollections
+
+/// Returns a file path that shares most of its bytes with its neighbors.
+private func path(_ i: Int) -> String {
+  "/usr/local/share/collections/\(i % 7)/items/item-\(i)"
+}
+
+/// Returns the UTF-8 bytes of a string, for comparing keys the way the
+/// dictionary does.
+private func utf8(_ string: String) -> [UInt8] {
+  Array(string.utf8)
+}
+
+/// Calls the given closure with every leaf of the dictionary.
+private func forEachLeaf<Value>(
+  of d: SortedStringDictionary<Value>,
+  _ body: (_StringKeyNode<Value>) -> Void
+) {
+  var stack = [d._root]
+  while let node = stack.popLast() {
+    if node.isLeaf {
+      body(node)
+    } else {
+      stack.append(contentsOf: node.children)
+    }
+  }
+}
+
+class SortedStringDictionaryTests: CollectionTestCase {
+  func test_updateAndRemove() {
+    let keys = ["", "a", "ab", "abc", "abd", "b", "ba", "caf\u{E9}", "\u{1F600}"]
+      + (0 ..< 40).map(path)
+    withEvery("seed", in: 0 ..< 10) { seed in
+      var rng = RepeatableRandomNumberGenerator(seed: seed)
+      var d = SortedStringDictionary<Int>()
+      var reference: [String: Int] = [:]
+      for _ in 0 ..< 500 {
+        let key = keys.randomElement(using: &rng)!
+        if Bool.random(using: &rng) {
+          let value = Int.random(in: -1000 ... 1000, using: &rng)
+          expectEqual(d.updateValue(value, forKey: key),
+                      reference.updateValue(value, forKey: key))
+        } else {
+          expectEqual(d.removeValue(forKey: key),
+                      reference.removeValue(forKey: key))
+        }
+        expectEqual(d.count, reference.count)
+      }
+
+      let expected = reference.sorted {
+        utf8($0.key).lexicographicallyPrecedes(utf8($1.key))
+      }
+      expectEqualElements(d.map { $0.key }, expected.map { $0.key })
+      expectEqualElements(d.map { $0.value }, expected.map { $0.value })
+      for key in keys {
+        expectEqual(d[key], reference[key])
+      }
+    }
+  }
+
+  func test_keysThatArePrefixesOfEachOther() {
+    var d = SortedStringDictionary<Int>()
+    let keys = (0 ..< 20).map { String(repeating: "x", count: $0) }
+    for (i, key) in keys.enumerated().reversed() {
+      d[key] = i
+    }
+    expectEqualElements(d.map { $0.key }, keys)
+    for (i, key) in keys.enumerated() {
+      expectEqual(d[key], i)
+    }
+    expectNil(d[String(repeating: "x", count: 20)])
+    expectNil(d["y"])
+  }
+
+  func test_removeAll() {
+    withEvery("count", in: [0, 1, 10, 100]) { count in
+      var d = SortedStringDictionary<Int>(
+        keysWithValues: (0 ..< count).map { (path($0), $0) })
+      for i in 0 ..< count {
+        expectEqual(d.removeValue(forKey: path(i)), i)
+      }
+      expectTrue(d.isEmpty)
+      expectEqual(Array(d).count, 0)
+    }
+  }
+
+  func test_leavesStoreSharedPrefixOnce() {
+    let count = 500
+    let d = SortedStringDictionary<Int>(
+      keysWithValues: (0 ..< count).map { (path($0), $0) })
+    let keyBytes = (0 ..< count).reduce(0) { $0 + path($1).utf8.count }
+
+    var storedBytes = 0
+    forEachLeaf(of: d) { leaf in
+      expectGreaterThanOrEqual(
+        leaf.prefix.count, "/usr/local/share/collections/".utf8.count)
+      storedBytes += leaf.prefix.count + leaf.suffixBytes.count
+    }
+    expectLessThan(storedBytes, keyBytes * 2 / 3)
+  }
+
+  func test_copyOnWrite() {
+    var d: SortedStringDictionary<Int> = ["a": 1, "b": 2, "c": 3]
+    for i in 0 ..< 50 {
+      d[path(i)] = i
+    }
+    let copy = d
+    d["b"] = 0
+    d["z"] = 26
+    d.removeValue(forKey: path(10))
+    expectEqual(copy["b"], 2)
+    expectNil(copy["z"])
+    expectEqual(copy[path(10)], 10)
+    expectEqual(copy.count, 53)
+    expectEqual(d.count, 53)
+    expectEqual(d["b"], 0)
+  }
+
+  func test_keysWithValues_keepsLastDuplicate() {
+    let d = SortedStringDictionary<Int>(
+      keysWithValues: [("b", 1), ("a", 2), ("b", 3)])
+    expectEqual(d["b"], 3)
+    expectEqual(d.count, 2)
+    expectEqual(d.description, "[a: 2, b: 3]")
+  }
+}
+#endif
@@ -0,0 +1,152 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift Collections open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+
+import XCTest
+import SortedCollections
+import _CollectionsTestSupport
+
+/// Sums the values, and tracks the minimum value and the keys in order.
+private struct Stats: SortedDictionarySummary, Equatable {
+  var sum: Int
+  var minimum: Int?
+  var keys: [Int]
+
+  static var zero: Stats { Stats(sum: 0, minimum: nil, keys: []) }
+
+  init(sum: Int, minimum: Int?, keys: [Int]) {
+    self.sum = sum
+    self.minimum = minimum
+    self.keys = keys
+  }
+
+  init(key: Int, value: Int) {
+    self.init(sum: value, minimum: value, keys: [key])
+  }
+
+  mutating func add(_ other: Stats) {
+    sum += other.sum
+    if let m = other.minimum {
+      minimum = Swift.min(minimum ?? m, m)
+    }
+    keys += other.keys
+  }
+}
+
+/// Summarizes the given key-value pairs one by one.
+private func bruteForce(
+  _ pairs: [(key: Int, value: Int)],
+  where isIncluded: (Int) -> Bool
+) -> Stats {
+  var result = Stats.zero
+  for (key, value) in pairs where isIncluded(key) {
+    result.add(Stats(key: key, value: value))
+  }
+  return result
+}
+
+class SummarizedSortedDictionaryTests: CollectionTestCase {
+  func test_updateAndRemove() {
+    withEvery("seed", in: 0 ..< 10) { seed in
+      var rng = RepeatableRandomNumberGenerator(seed: seed)
+      var d = SummarizedSortedDictionary<Stats>()
+      var reference: [Int: Int] = [:]
+      for _ in 0 ..< 500 {
+        let key = Int.random(in: 0 ..< 100, using: &rng)
+        if Bool.random(using: &rng) {
+          let value = Int.random(in: -1000 ... 1000, using: &rng)
+          expectEqual(d.updateValue(value, forKey: key),
+                      reference.updateValue(value, forKey: key))
+        } else {
+          expectEqual(d.removeValue(forKey: key),
+                      reference.removeValue(forKey: key))
+        }
+        expectEqual(d.count, reference.count)
+      }
+
+      let expected = reference.sorted { $0.key < $1.key }
+        .map { (key: $0.key, value: $0.value) }
+      expectEqualElements(d.map { $0.key }, expected.map { $0.key })
+      expectEqualElements(d.map { $0.value }, expected.map { $0.value })
+      expectEqual(d.summary, bruteForce(expected, where: { _ in true }))
+      for key in 0 ..< 100 {
+        expectEqual(d[key], reference[key])
+      }
+    }
+  }
+
+  func test_removeAll() {
+    withEvery("count", in: [0, 1, 10, 100]) { count in
+      var d = SummarizedSortedDictionary<Stats>(
+        keysWithValues: (0 ..< count).map { ($0, $0) })
+      for key in 0 ..< count {
+        d[key] = nil
+      }
+      expectTrue(d.isEmpty)
+      expectEqual(d.summary, .zero)
+      expectEqual(Array(d).count, 0)
+    }
+  }
+
+  func test_summaryOfRange() {
+    withEvery("count", in: [0, 1, 5, 30, 60]) { count in
+      let pairs = (0 ..< count).map { (key: 2 * $0, value: ($0 * 7919) % 101) }
+      let d = SummarizedSortedDictionary<Stats>(
+        keysWithValues: pairs.map { ($0.key, $0.value) })
+      let bound = 2 * count + 1
+      withEvery("lower", in: -1 ... bound) { lower in
+        withEvery("upper", in: lower ... bound) { upper in
+          expectEqual(
+            d.summary(of: lower ..< upper),
+            bruteForce(pairs, where: { lower <= $0 && $0 < upper }))
+          expectEqual(
+            d.summary(of: lower ... upper),
+            bruteForce(pairs, where: { lower <= $0 && $0 <= upper }))
+        }
+        expectEqual(
+          d.summary(of: lower...),
+          bruteForce(pairs, where: { lower <= $0 }))
+        expectEqual(
+          d.summary(of: ..<lower),
+          bruteForce(pairs, where: { $0 < lower }))
+        expectEqual(
+          d.summary(of: ...lower),
+          bruteForce(pairs, where: { $0 <= lower }))
+      }
+    }
+  }
+
+  func test_copyOnWrite() {
+    var d: SummarizedSortedDictionary<Stats> = [1: 10, 2: 20, 3: 30]
+    for key in 4 ..< 50 {
+      d[key] = key * 10
+    }
+    let copy = d
+    d[2] = 0
+    d[100] = 1000
+    d.removeValue(forKey: 10)
+    expectEqual(copy[2], 20)
+    expectNil(copy[100])
+    expectEqual(copy[10], 100)
+    expectEqual(copy.count, 49)
+    expectEqual(copy.summary.sum, (1 ..< 50).reduce(0) { $0 + 10 * $1 })
+    expectEqual(d.count, 49)
+    expectEqual(d[2], 0)
+  }
+
+  func test_keysWithValues_keepsLastDuplicate() {
+    let d = SummarizedSortedDictionary<Stats>(
+      keysWithValues: [(1, 1), (2, 2), (1, 3)])
+    expectEqual(d[1], 3)
+    expectEqual(d.count, 2)
+    expectEqual(d.description, "[1: 3, 2: 2]")
+  }
+}